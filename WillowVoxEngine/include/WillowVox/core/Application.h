@@ -13,7 +13,7 @@ namespace WillowVox
 	{
 	public:
 		Application();
-		~Application();
+		virtual ~Application();
 
 		void Run();
 
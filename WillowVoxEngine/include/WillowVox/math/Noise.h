@@ -1,16 +1,15 @@
 #pragma once
 
 #include <WillowVox/WillowVoxDefines.h>
-#include <FastNoiseLite.h>
 #include <WillowVox/math/NoiseSettings.h>
 
 namespace WillowVox
 {
+    // Perlin noise matching FastNoiseLite's. Sampling keeps no shared state, so any number of threads
+    // can sample at once and always get the same values.
     class WILLOWVOX_API Noise
     {
     public:
-        static FastNoiseLite noise;
-
         static void InitNoise();
 
         static float GetValue2D(NoiseSettings2D& settings, int seed, float x, float y);
@@ -20,5 +19,29 @@ namespace WillowVox
         static float GetValue3D(NoiseSettings3D& settings, int seed, float x, float y, float z);
         static float GetValue3D(CaveNoiseSettings& settings, int seed, float x, float y, float z);
         static float GetValue3D(OreNoiseSettings& settings, int seed, float x, float y, float z);
+
+        // Batch versions of the functions above. They fill out with sizeX * sizeY (2D) or sizeX * sizeY * sizeZ (3D)
+        // samples step apart starting at (x, y[, z]), last axis first like ChunkData. Each sample is exactly what
+        // the single sample function returns at that point.
+        static void GetValues2D(NoiseSettings2D& settings, int seed, float x, float y, int sizeX, int sizeY, float* out, float step = 1.0f);
+        static void GetValuesLayered2D(NoiseSettings2D* settings, int layers, int seed, float x, float y, int sizeX, int sizeY, float* out, float step = 1.0f);
+        static void GetValues3D(NoiseSettings3D& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step = 1.0f);
+        static void GetValues3D(CaveNoiseSettings& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step = 1.0f);
+        static void GetValues3D(OreNoiseSettings& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step = 1.0f);
+
+        // Cave and ore noise sampled every settings.m_sampleStep blocks on a lattice aligned to world coordinates and
+        // trilinearly interpolated in between, so neighboring chunks agree on their borders. With a step of 1 these
+        // are GetValue3D and GetValues3D. The batch versions give the same values as the single sample ones.
+        static float GetUpsampledValue3D(CaveNoiseSettings& settings, int seed, int x, int y, int z);
+        static float GetUpsampledValue3D(OreNoiseSettings& settings, int seed, int x, int y, int z);
+        static void GetUpsampledValues3D(CaveNoiseSettings& settings, int seed, int x, int y, int z, int sizeX, int sizeY, int sizeZ, float* out);
+        static void GetUpsampledValues3D(OreNoiseSettings& settings, int seed, int x, int y, int z, int sizeX, int sizeY, int sizeZ, float* out);
+
+        // Instruction sets the batch functions can run on. InitNoise picks the best one the CPU supports.
+        enum SimdLevel { SCALAR, SSE41, AVX2 };
+        static SimdLevel GetSimdLevel();
+        // Uses level, or the best supported one below it. Not thread safe, set it before generating.
+        static void SetSimdLevel(SimdLevel level);
+        static const char* GetSimdLevelName(SimdLevel level);
     };
 }
\ No newline at end of file
@@ -41,10 +41,10 @@ namespace WillowVox
     struct WILLOWVOX_API CaveNoiseSettings
     {
         CaveNoiseSettings(float frequency, int octaves,
-            float persistence, float lacunarity, float noiseThreshold, float xOffset = 0, float yOffset = 0, float zOffset = 0)
+            float persistence, float lacunarity, float noiseThreshold, float xOffset = 0, float yOffset = 0, float zOffset = 0, int sampleStep = 1)
             : m_amplitude(1.0f), m_frequency(frequency), m_octaves(octaves),
             m_persistence(persistence), m_lacunarity(lacunarity), m_noiseThreshold(noiseThreshold),
-            m_xOffset(xOffset), m_yOffset(yOffset), m_zOffset(zOffset) {}
+            m_xOffset(xOffset), m_yOffset(yOffset), m_zOffset(zOffset), m_sampleStep(sampleStep) {}
 
         float m_amplitude;
         float m_frequency;
@@ -53,15 +53,17 @@ namespace WillowVox
         float m_lacunarity;
         float m_noiseThreshold;
         float m_xOffset, m_yOffset, m_zOffset;
+        // Noise is sampled every m_sampleStep blocks and interpolated in between, 1 samples every block
+        int m_sampleStep;
     };
 
     struct WILLOWVOX_API OreNoiseSettings
     {
         OreNoiseSettings(float frequency, int octaves,
-            float persistence, float lacunarity, float noiseThreshold, uint16_t replaceBlock, float xOffset = 0, float yOffset = 0, float zOffset = 0)
+            float persistence, float lacunarity, float noiseThreshold, uint16_t replaceBlock, float xOffset = 0, float yOffset = 0, float zOffset = 0, int sampleStep = 1)
             : m_amplitude(1.0f), m_frequency(frequency), m_octaves(octaves),
             m_persistence(persistence), m_lacunarity(lacunarity), m_noiseThreshold(noiseThreshold), m_replaceBlock(replaceBlock),
-            m_xOffset(xOffset), m_yOffset(yOffset), m_zOffset(zOffset) {}
+            m_xOffset(xOffset), m_yOffset(yOffset), m_zOffset(zOffset), m_sampleStep(sampleStep) {}
 
         float m_amplitude;
         float m_frequency;
@@ -71,5 +73,7 @@ namespace WillowVox
         float m_noiseThreshold;
         uint16_t m_replaceBlock;
         float m_xOffset, m_yOffset, m_zOffset;
+        // Noise is sampled every m_sampleStep blocks and interpolated in between, 1 samples every block
+        int m_sampleStep;
     };
 }
\ No newline at end of file
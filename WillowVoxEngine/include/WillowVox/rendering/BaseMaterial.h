@@ -11,6 +11,7 @@ namespace WillowVox
 	{
 	public:
 		BaseMaterial(Shader* shader);
+		virtual ~BaseMaterial() = default;
 
 		void Bind();
 
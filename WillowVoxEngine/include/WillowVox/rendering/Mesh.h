@@ -17,11 +17,15 @@ namespace WillowVox
 	class WILLOWVOX_API Mesh
 	{
 	public:
+		virtual ~Mesh() {}
+
 		virtual void Render(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) = 0; // Bind material and render
 		virtual void Render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) = 0; // Bind material and render
 		virtual void RenderAsInstance(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) = 0; // Render without binding material
 
 		virtual void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numVertices, uint32_t* indices, int numIndices) = 0;
+		// 4 vertices per quad ordered bottom-left, bottom-right, top-left, top-right, drawn with the shared QuadIndexBuffer
+		virtual void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numQuads) = 0;
 		virtual void SetVertexProperties(BaseMaterial& material) = 0;
 	};
 }
\ No newline at end of file
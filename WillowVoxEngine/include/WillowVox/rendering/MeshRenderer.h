@@ -42,7 +42,7 @@ namespace WillowVox
 
     private:
         BaseMaterial& _material;
-        Mesh* _mesh;
+        Mesh* _mesh = nullptr;
 
         bool _destroyMeshWhenDestroyed = false;
     };
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/world/WorldGlobals.h>
+#include <vector>
+#include <cstdint>
+
+namespace WillowVox
+{
+    /* Every quad mesh is indexed the same way, 0, 1, 2, 2, 1, 3 offset by 4 vertices per quad.
+       The backend uploads these indices once and binds them for every quad mesh instead of
+       each mesh building and uploading its own. */
+    class WILLOWVOX_API QuadIndexBuffer
+    {
+    public:
+        // At most every other block of a chunk can show all six faces
+        static constexpr int MAX_QUADS = CHUNK_VOLUME / 2 * 6;
+        static constexpr int INDICES_PER_QUAD = 6;
+
+        // MAX_QUADS * INDICES_PER_QUAD indices, built on first use
+        static const std::vector<uint32_t>& GetIndices();
+    };
+}
@@ -21,6 +21,8 @@ namespace WillowVox
 	class WILLOWVOX_API RenderingAPI
 	{
 	public:
+		virtual ~RenderingAPI() {}
+
 		// Function to get the correct rendering API without having to include unused APIs
 		static RenderingAPI* GetRenderingAPI();
 
@@ -38,6 +40,8 @@ namespace WillowVox
 		virtual void SetVertexAttrib1b(int id, uint32_t size, std::size_t offset) = 0;
 		virtual void SetVertexAttrib2b(int id, uint32_t size, std::size_t offset) = 0;
 		virtual void SetVertexAttrib3b(int id, uint32_t size, std::size_t offset) = 0;
+		// Integer attribute, read as a uint in the shader
+		virtual void SetVertexAttrib1ui(int id, uint32_t size, std::size_t offset) = 0;
 		
 		// Getters
 		virtual double GetTime() = 0;
@@ -8,6 +8,8 @@ namespace WillowVox
 	class WILLOWVOX_API Shader
 	{
 	public:
+		virtual ~Shader() {}
+
 		virtual void Bind() = 0;
 
         virtual void SetBool(const char* name, bool value) const = 0;
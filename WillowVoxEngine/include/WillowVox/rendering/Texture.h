@@ -7,6 +7,8 @@ namespace WillowVox
     class WILLOWVOX_API Texture
     {
     public:
+        virtual ~Texture() {}
+
         enum TexSlot
         {
             TEX00,
@@ -30,6 +30,8 @@ namespace WillowVox
 	class WILLOWVOX_API Window
 	{
 	public:
+		virtual ~Window() {}
+
 		// Actions
 		virtual void FrameStart() = 0;
 		virtual void PostProcessingStart() = 0;
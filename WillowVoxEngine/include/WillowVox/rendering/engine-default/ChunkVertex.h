@@ -2,20 +2,34 @@
 
 #include <WillowVox/WillowVoxDefines.h>
 #include <WillowVox/rendering/BaseVertex.h>
-#include <glm/glm.hpp>
+#include <cstdint>
 
 namespace WillowVox
 {
+	// A solid chunk vertex packed into 32 bits, low to high:
+	// x, y, z (6 bits each, 0 to CHUNK_SIZE), direction (3), face corner (2), atlas tile (9)
 	class WILLOWVOX_API ChunkVertex : public BaseVertex
 	{
 	public:
-		ChunkVertex(char xPos, char yPos, char zPos, glm::vec2 texPos, char direction)
-			: m_x(xPos), m_y(yPos), m_z(zPos), m_texPos(texPos), m_direction(direction) {}
-		ChunkVertex(char xPos, char yPos, char zPos, float texX, float texY, char direction)
-			: m_x(xPos), m_y(yPos), m_z(zPos), m_texPos({texX,texY}), m_direction(direction) {}
+		ChunkVertex(int x, int y, int z, int direction, int corner, int tile)
+			: m_data(Pack(x, y, z, direction, corner, tile)) {}
 
-		char m_x, m_y, m_z;
-		glm::vec2 m_texPos;
-		char m_direction;
+		static constexpr uint32_t Pack(int x, int y, int z, int direction, int corner, int tile)
+		{
+			return (uint32_t)x | (uint32_t)y << 6 | (uint32_t)z << 12 | (uint32_t)direction << 18 | (uint32_t)corner << 21 | (uint32_t)tile << 23;
+		}
+
+		static constexpr int GetX(uint32_t data) { return data & 63; }
+		static constexpr int GetY(uint32_t data) { return data >> 6 & 63; }
+		static constexpr int GetZ(uint32_t data) { return data >> 12 & 63; }
+		static constexpr int GetDirection(uint32_t data) { return data >> 18 & 7; }
+		static constexpr int GetCorner(uint32_t data) { return data >> 21 & 3; }
+		static constexpr int GetTile(uint32_t data) { return data >> 23; }
+
+		// Tiles are numbered in rows of ATLAS_TILES_PER_ROW, the shader unpacks them the same way
+		static constexpr int ATLAS_TILES_PER_ROW = 16;
+		static constexpr int GetTileIndex(int tileX, int tileY) { return tileY * ATLAS_TILES_PER_ROW + tileX; }
+
+		uint32_t m_data;
 	};
-}
\ No newline at end of file
+}
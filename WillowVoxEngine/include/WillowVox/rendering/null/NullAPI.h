@@ -0,0 +1,116 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstdio>
+
+namespace WillowVox
+{
+	// One call into the null backend
+	struct WILLOWVOX_API RenderCommand
+	{
+		enum Type
+		{
+			FRAME_START,
+			FRAME_END,
+			CREATE_MESH,
+			DELETE_MESH,
+			UPLOAD_MESH,
+			DRAW_MESH,
+			CREATE_SHADER,
+			BIND_SHADER,
+			SET_UNIFORM,
+			CREATE_TEXTURE,
+			BIND_TEXTURE,
+			SET_VERTEX_ATTRIB,
+			SET_STATE,
+			DRAW_TRIANGLES,
+			DRAW_UI
+		};
+
+		RenderCommand(Type type, const void* object = nullptr, std::string name = {}) : type(type), object(object), name(std::move(name)) {}
+
+		Type type;
+		// The mesh, shader, texture or window the command is about
+		const void* object = nullptr;
+		// Uniform, state or vertex attribute name, or the path a shader or texture was created from
+		std::string name;
+		// Vertices uploaded or drawn, attribute id, texture slot or frame number
+		int count = 0;
+		// Vertex size or attribute stride
+		uint32_t size = 0;
+		// Uniform or state values, matrices are column major
+		float values[16] = {};
+		int valueCount = 0;
+	};
+
+	/* A rendering backend that needs no GPU or window, for benchmarks, tools and running the
+	   game on headless machines. Nothing is drawn: every upload, draw call, state change and
+	   uniform set is appended to m_commands while m_recording is set, and the totals below
+	   are kept either way. Like the OpenGL backend it must only be used from the main thread. */
+	class WILLOWVOX_API NullAPI : public RenderingAPI
+	{
+	public:
+		// Rendering objects
+		Window* CreateWindow(int width, int height, const char* title) override;
+		Shader* CreateShader(const char* vertexShaderPath, const char* fragmentShaderPath) override;
+		Shader* CreateShaderFromString(const char* vertexShaderCode, const char* fragmentShaderCode) override;
+		Mesh* CreateMesh() override;
+		Texture* CreateTexture(const char* path) override;
+
+		// Vertex attributes
+		void SetVertexAttrib1f(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib2f(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib3f(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib1b(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib2b(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib3b(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib1ui(int id, uint32_t size, std::size_t offset) override;
+
+		// Getters
+		double GetTime() override;
+
+		// Setters
+		void SetCullFace(bool enabled) override;
+		void SetDepthTest(bool enabled) override;
+		void SetBlending(bool enabled) override;
+		void SetInvertRenderMode(bool enabled) override;
+		void SetRenderingMode(RenderMode mode) override;
+		void SetLineWidth(float width) override;
+		void SetVsync(bool enabled) override;
+
+		// Raw (mostly debug) rendering
+		void RenderTriangles(glm::vec3* vertices, int vertexCount, glm::vec4 color) override;
+
+		// Appends command to the log if recording
+		void Record(const RenderCommand& command);
+		void ClearCommands() { m_commands.clear(); }
+		std::size_t CountCommands(RenderCommand::Type type) const;
+		static const char* GetCommandName(RenderCommand::Type type);
+		// One command per line
+		void WriteCommands(FILE* file) const;
+
+		std::vector<RenderCommand> m_commands;
+		bool m_recording = true;
+		// Windows clear the log at the start of every frame so it holds one frame
+		bool m_clearEachFrame = true;
+
+		// Totals over every mesh created by this API
+		uint64_t m_meshUploads = 0;
+		uint64_t m_uploadedVertices = 0;
+		uint64_t m_uploadedBytes = 0;
+		uint64_t m_drawCalls = 0;
+		uint64_t m_drawnVertices = 0;
+
+		// Window frames are paced to 60 per second while set, like a vsynced swap
+		bool m_vsync = true;
+
+	private:
+		void RecordState(const char* name, float value);
+		void RecordVertexAttrib(const char* type, int id, uint32_t size, std::size_t offset);
+	};
+}
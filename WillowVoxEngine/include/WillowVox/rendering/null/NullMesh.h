@@ -0,0 +1,34 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/rendering/Mesh.h>
+
+namespace WillowVox
+{
+	class NullAPI;
+
+	// Keeps the size of the last upload instead of the vertices
+	class WILLOWVOX_API NullMesh : public Mesh
+	{
+	public:
+		NullMesh(NullAPI& api);
+		~NullMesh();
+
+		void Render(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) override;
+		void Render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) override;
+		void RenderAsInstance(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) override;
+
+		void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numVertices, uint32_t* indices, int numIndices) override;
+		void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numQuads) override;
+		void SetVertexProperties(BaseMaterial& material) override;
+
+		int m_vertexCount = 0;
+		int m_indexCount = 0;
+		uint32_t m_vertexSize = 0;
+
+	private:
+		void Draw(const PolygonMode& mode);
+
+		NullAPI& _api;
+	};
+}
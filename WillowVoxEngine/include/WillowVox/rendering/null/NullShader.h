@@ -0,0 +1,37 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/rendering/Shader.h>
+#include <string>
+
+namespace WillowVox
+{
+	class NullAPI;
+
+	// Records binds and uniform sets
+	class WILLOWVOX_API NullShader : public Shader
+	{
+	public:
+		NullShader(NullAPI& api, const char* name);
+
+		void Bind() override;
+
+		void SetBool(const char* name, bool value) const override;
+		void SetInt(const char* name, int value) const override;
+		void SetFloat(const char* name, float value) const override;
+		void SetVec2(const char* name, glm::vec2 value) const override;
+		void SetVec2(const char* name, float x, float y) const override;
+		void SetVec3(const char* name, glm::vec3 value) const override;
+		void SetVec3(const char* name, float x, float y, float z) const override;
+		void SetVec4(const char* name, glm::vec4 value) const override;
+		void SetVec4(const char* name, float x, float y, float z, float w) const override;
+		void SetMat4(const char* name, glm::mat4 value) const override;
+
+		std::string m_name;
+
+	private:
+		void SetUniform(const char* name, const float* values, int count) const;
+
+		NullAPI& _api;
+	};
+}
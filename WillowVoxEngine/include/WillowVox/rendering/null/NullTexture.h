@@ -0,0 +1,21 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/rendering/Texture.h>
+
+namespace WillowVox
+{
+    class NullAPI;
+
+    class WILLOWVOX_API NullTexture : public Texture
+    {
+    public:
+        // Nothing is loaded, the size is the block atlas' so materials get sensible texture scales
+        NullTexture(NullAPI& api);
+
+        void BindTexture(TexSlot slot) override;
+
+    private:
+        NullAPI& _api;
+    };
+}
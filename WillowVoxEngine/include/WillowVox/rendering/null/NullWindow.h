@@ -0,0 +1,63 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/rendering/Window.h>
+#include <imgui/imgui.h>
+#include <chrono>
+#include <unordered_set>
+
+namespace WillowVox
+{
+	class NullAPI;
+
+	/* A window that never opens. It closes itself after m_maxFrames frames (0 runs until
+	   CloseWindow), and keys and the mouse are set from code. The UI is still built with
+	   ImGui every frame, only its draw data is thrown away. */
+	class WILLOWVOX_API NullWindow : public Window
+	{
+	public:
+		NullWindow(NullAPI& api, int width, int height);
+		~NullWindow();
+
+		// Actions
+		void FrameStart() override;
+		void PostProcessingStart() override;
+		void PostProcessingEnd() override;
+		void UIStart() override;
+		void UIEnd() override;
+		void FrameEnd() override;
+		void CloseWindow() override;
+
+		// Set variables
+		void SetBackgroundColor(glm::vec4 color) override;
+		void SetBackgroundColor(float r, float g, float b, float a) override;
+
+		void SetMouseDisabled(bool state) override;
+		void ToggleMouseDisabled() override;
+
+		// Scripted input, fires the same events a real window would
+		void SetKeyDown(Key key, bool down);
+		void SetMousePos(glm::vec2 pos);
+
+		// Get variables
+		bool ShouldClose() override;
+		glm::ivec2 GetWindowSize() override;
+		bool KeyDown(Key key) override;
+		bool MouseButtonDown(int button) override;
+		glm::vec2 GetMousePos() override;
+		bool MouseDisabled() override;
+
+		int m_maxFrames = 0;
+		int m_frame = 0;
+
+	private:
+		NullAPI& _api;
+		glm::ivec2 _size;
+		bool _shouldClose = false;
+		bool _mouseDisabled = false;
+		glm::vec2 _mousePos = { 0, 0 };
+		std::unordered_set<int> _keysDown;
+		std::chrono::steady_clock::time_point _lastFrameEnd;
+		ImGuiContext* _imguiContext;
+	};
+}
@@ -27,6 +27,7 @@ namespace WillowVox
 		void SetVertexAttrib1b(int id, uint32_t size, std::size_t offset) override;
 		void SetVertexAttrib2b(int id, uint32_t size, std::size_t offset) override;
 		void SetVertexAttrib3b(int id, uint32_t size, std::size_t offset) override;
+		void SetVertexAttrib1ui(int id, uint32_t size, std::size_t offset) override;
 
 		// Getters
 		double GetTime() override;
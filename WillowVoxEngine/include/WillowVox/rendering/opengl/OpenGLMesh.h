@@ -16,6 +16,7 @@ namespace WillowVox
 		void RenderAsInstance(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode = PolygonMode::Triangle) override; // Render without binding material
 
 		void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numVertices, uint32_t* indices, int numIndices) override;
+		void SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numQuads) override;
 		void SetVertexProperties(BaseMaterial& material) override;
 	
 	private:
@@ -4,6 +4,8 @@
 #include <WillowVox/rendering/MeshRenderer.h>
 #include <WillowVox/rendering/BaseMaterial.h>
 #include <WillowVox/world/ChunkData.h>
+#include <WillowVox/world/ChunkPool.h>
+#include <WillowVox/resources/Block.h>
 #include <WillowVox/rendering/engine-default/ChunkVertex.h>
 #include <WillowVox/rendering/engine-default/FluidVertex.h>
 #include <WillowVox/rendering/engine-default/Vertex.h>
@@ -19,10 +21,59 @@ namespace WillowVox
     class WILLOWVOX_API Chunk
     {
     public:
+        // A block written to a ChunkData index, see ApplyEdits
+        struct BlockEdit
+        {
+            uint16_t index;
+            uint16_t block;
+        };
+
         Chunk(ChunkManager& chunkManager, BaseMaterial* solidMaterial, BaseMaterial* fluidMaterial, BaseMaterial* billboardMaterial, const glm::ivec3& chunkPos, const glm::vec3& worldPos);
         ~Chunk();
 
+        // Chunks come from ChunkPools, a derived type of another size from the heap
+        static void* operator new(std::size_t size);
+        static void operator delete(void* chunk, std::size_t size);
+
+        // Chunks are meshed in slabs of SECTION_HEIGHT layers so an edit only remeshes the slabs it touches
+        static constexpr int SECTION_HEIGHT = 8;
+        static constexpr int SECTION_COUNT = CHUNK_SIZE / SECTION_HEIGHT;
+
+        // Meshing reads a copy of the chunk with a one block border taken from its neighbors
+        static constexpr int PADDED_SIZE = CHUNK_SIZE + 2;
+        static constexpr int PADDED_VOLUME = PADDED_SIZE * PADDED_SIZE * PADDED_SIZE;
+        // Local coordinates from -1 to CHUNK_SIZE
+        static int GetPaddedIndex(int x, int y, int z) { return ((x + 1) * PADDED_SIZE + y + 1) * PADDED_SIZE + z + 1; }
+
+        // Indexed by face direction, matching the normals in the chunk shaders:
+        // 0 south (+z), 1 north (-z), 2 east (+x), 3 west (-x), 4 up (+y), 5 down (-y)
+        static const glm::ivec3 FACE_NORMALS[6];
+
+        struct SectionMeshData
+        {
+            // Quads of 4 vertices, indexed by the shared QuadIndexBuffer
+            MeshVector<ChunkVertex> solidVertices;
+            MeshVector<FluidVertex> fluidVertices;
+            MeshVector<Vertex> billboardVertices;
+        };
+
+        // Buffers meshing works in. Each worker keeps one and reuses it for every chunk it meshes,
+        // so their capacity is only paid for once per thread.
+        struct MeshScratch
+        {
+            // PADDED_VOLUME blocks in GetPaddedIndex order. The border's edges and corners are never read and stay air.
+            std::vector<uint16_t> blocks;
+            // Set when every block inside the chunk is the same, the border may still differ
+            bool uniform = false;
+            std::vector<int> otherBlocks;
+            SectionMeshData sections[SECTION_COUNT];
+        };
+
+        // Meshes the chunk into scratch and keeps the spliced result for GenerateChunkMesh to upload.
+        // Without a scratch, one kept per thread is used.
+        void GenerateChunkMeshData(MeshScratch& scratch);
         void GenerateChunkMeshData();
+        // Uploads the mesh data, then frees it unless the ChunkManager retains CPU meshes
         void GenerateChunkMesh();
         void RenderSolid(const glm::mat4& view, const glm::mat4& projection);
         void RenderTransparent();
@@ -30,19 +81,48 @@ namespace WillowVox
         uint16_t GetBlockIdAtPos(int x, int y, int z);
         void SetBlock(int x, int y, int z, uint16_t block);
         void ReloadChunk();
+        // Writes the edits in order under one lock and marks the sections they touch dirty,
+        // here and in neighboring chunks, without remeshing anything
+        void ApplyEdits(const BlockEdit* edits, std::size_t count);
+        // Marks the sections holding the local layers set in layers (bit per y) for remeshing
+        void MarkLayersDirty(uint32_t layers);
+        // Remeshes only the sections marked dirty since the last mesh and uploads the result
+        void ReloadDirtySections();
+        // Calls ReloadDirtySections on the six neighboring chunks
+        void ReloadDirtyNeighbors();
+
+        // Size of the CPU mesh data from GenerateChunkMeshData, 0 once it was uploaded and freed
+        std::size_t GetMeshVertexCount() const;
+        std::size_t GetMeshDataSize() const;
+        // Sections rebuilt by the last mesh (bit per section)
+        uint32_t GetLastRemeshedSections() const { return _lastRemeshedSections; }
 
         ChunkData* m_chunkData;
-        ChunkData* m_northData;
-        ChunkData* m_southData;
-        ChunkData* m_eastData;
-        ChunkData* m_westData;
-        ChunkData* m_upData;
-        ChunkData* m_downData;
+        // Indexed like FACE_NORMALS, only read while copying the border for meshing. Missing neighbors are air.
+        ChunkData* m_neighborData[6];
 
         glm::ivec3 m_chunkPos;
         bool m_ready = false;
 
     private:
+        // Remeshes the sections set in sectionMask (bit per section), along with any section that
+        // has no retained copy, and splices the chunk's mesh into _meshData
+        void RemeshSections(uint32_t sectionMask, MeshScratch& scratch);
+        // Rebuilds the mesh data of the sections set in sectionMask into scratch.sections
+        void GenerateSectionMeshData(uint32_t sectionMask, MeshScratch& scratch);
+        // Copies the chunk and its border into scratch.blocks, holding the chunk locks only for the copy.
+        // Returns false if the chunk is all air and there's nothing to mesh.
+        bool CopyMeshBlocks(MeshScratch& scratch) const;
+        // Merges the visible faces of solid blocks into quads of the same block. columns[axis]
+        // holds a bit per solid block along that axis, indexed by the other two axes in xyz order.
+        // Bit i + 1 is the block at i, bits 0 and CHUNK_SIZE + 1 are the border.
+        // Only layers set in yMask are meshed and quads never cross a section boundary.
+        void GenerateGreedySolidMeshData(const uint16_t* blocks, const uint64_t (&columns)[3][CHUNK_SIZE][CHUNK_SIZE], uint32_t yMask, SectionMeshData* sections);
+        // Faces go to the section holding y. size is the quad's extent in blocks, 1 along the face normal
+        static void AddSolidFace(SectionMeshData* sections, int x, int y, int z, int direction, const Block& block, const glm::ivec3& size);
+        static void AddFluidFace(SectionMeshData* sections, int x, int y, int z, int direction, const Block& block, bool lowerTop);
+        static void AddBillboard(SectionMeshData* sections, int x, int y, int z, const Block& block);
+
         ChunkManager& _chunkManager;
 
         glm::vec3 _worldPos;
@@ -54,11 +134,13 @@ namespace WillowVox
         BaseMaterial* _fluidMaterial;
         BaseMaterial* _billboardMaterial;
 
-        std::vector<ChunkVertex> _solidVertices;
-        std::vector<uint32_t> _solidIndices;
-        std::vector<FluidVertex> _fluidVertices;
-        std::vector<uint32_t> _fluidIndices;
-        std::vector<Vertex> _billboardVertices;
-        std::vector<uint32_t> _billboardIndices;
+        // Spliced meshes waiting for GenerateChunkMesh
+        SectionMeshData _meshData;
+        // Per section copies so edits only remesh the sections they touch.
+        // _retainedSections has a bit set for each one that's up to date.
+        SectionMeshData _sections[SECTION_COUNT];
+        uint32_t _retainedSections = 0;
+        uint32_t _lastRemeshedSections = 0;
+        uint32_t _dirtySections = 0;
     };
 }
\ No newline at end of file
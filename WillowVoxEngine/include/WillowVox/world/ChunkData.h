@@ -2,34 +2,244 @@
 
 #include <WillowVox/WillowVoxDefines.h>
 #include <WillowVox/world/WorldGlobals.h>
+#include <WillowVox/world/ChunkPool.h>
 #include <glm/glm.hpp>
+#include <vector>
+#include <shared_mutex>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
 
 namespace WillowVox
 {
+    /* Voxels are stored as indices into a palette of the block ids used by the chunk,
+       packed at 1, 2, 4 or 8 bits per voxel. The width grows as new ids are written.
+       Past 256 ids the palette is dropped and ids are stored directly at 16 bits.
+       A chunk holding a single id (all air, all stone...) is uniform: it stores only
+       that id and allocates nothing until a different block is written.
+       SetBlock can reallocate the storage, so writers hold m_mutex exclusively and
+       readers on other threads hold it shared. ChunkData objects and their storage come
+       from ChunkPools. */
     struct WILLOWVOX_API ChunkData
     {
     public:
-        ChunkData(uint16_t* voxels, glm::ivec3 offset) : m_voxels(voxels), m_offset(offset) {}
-        ChunkData() : m_offset({ 0, 0, 0 }) { m_voxels = new uint16_t[CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE]; }
-        ~ChunkData() { delete[] m_voxels; }
+        // Takes ownership of voxels (CHUNK_VOLUME ids in GetIndex order) and packs them
+        ChunkData(uint16_t* voxels, glm::ivec3 offset) : m_offset(offset)
+        {
+            Fill(voxels[0]);
+            for (int i = 0; i < CHUNK_VOLUME; i++)
+                SetBlockAtIndex(i, voxels[i]);
+            delete[] voxels;
+        }
+        ChunkData() : m_offset({ 0, 0, 0 }) { Fill(0); }
+        ~ChunkData() { FreeData(); }
+
+        ChunkData(const ChunkData&) = delete;
+        ChunkData& operator=(const ChunkData&) = delete;
+
+        // Pooled, a derived type of another size goes to the heap
+        static void* operator new(std::size_t size)
+        {
+            if (size != sizeof(ChunkData))
+                return ::operator new(size);
+            return ChunkPools::GetChunkDataPool().Allocate();
+        }
+        static void operator delete(void* chunkData, std::size_t size)
+        {
+            if (size != sizeof(ChunkData))
+                ::operator delete(chunkData);
+            else
+                ChunkPools::GetChunkDataPool().Free(chunkData);
+        }
 
         inline int GetIndex(int x, int y, int z) const
         {
             return x * CHUNK_SIZE * CHUNK_SIZE + y * CHUNK_SIZE + z;
         }
 
-        uint16_t GetBlock(int x, int y, int z)
+        uint16_t GetBlock(int x, int y, int z) const
         {
-            return m_voxels[GetIndex(x, y, z)];
+            return GetBlockAtIndex(GetIndex(x, y, z));
         }
 
         void SetBlock(int x, int y, int z, uint16_t block)
         {
-            m_voxels[GetIndex(x, y, z)] = block;
+            SetBlockAtIndex(GetIndex(x, y, z), block);
+        }
+
+        inline uint16_t GetBlockAtIndex(int index) const
+        {
+            uint32_t value = GetRawValue(_data, index);
+            return _palette.empty() ? (uint16_t)value : _palette[value];
+        }
+
+        void SetBlockAtIndex(int index, uint16_t block)
+        {
+            // Look up the value first, adding a palette entry may reallocate _data
+            uint32_t value = _palette.empty() ? block : GetPaletteIndex(block);
+            uint32_t& word = _data[index >> _wordShift];
+            int shift = (index & _wordMask) << _bitsShift;
+            word = (word & ~(_valueMask << shift)) | (value << shift);
+        }
+
+        // Drops all voxel storage and makes every voxel block
+        void Fill(uint16_t block)
+        {
+            FreeData();
+            _palette.assign(1, block);
+            SetLayout(0);
+            _data = &_uniformWord;
+        }
+
+        // Rebuilds the palette from the ids still in use. Collapses the chunk
+        // back to uniform when only one id is left.
+        void Compact()
+        {
+            if (IsUniform())
+                return;
+
+            if (!_palette.empty())
+            {
+                std::vector<bool> used(_palette.size(), false);
+                std::size_t usedCount = 0;
+                for (int i = 0; i < CHUNK_VOLUME && usedCount < _palette.size(); i++)
+                {
+                    uint32_t value = GetRawValue(_data, i);
+                    if (!used[value])
+                    {
+                        used[value] = true;
+                        usedCount++;
+                    }
+                }
+                if (usedCount == _palette.size())
+                    return;
+            }
+
+            std::vector<uint16_t> blocks(CHUNK_VOLUME);
+            for (int i = 0; i < CHUNK_VOLUME; i++)
+                blocks[i] = GetBlockAtIndex(i);
+            Fill(blocks[0]);
+            for (int i = 0; i < CHUNK_VOLUME; i++)
+                SetBlockAtIndex(i, blocks[i]);
+        }
+
+        bool IsUniform() const { return _bitsPerVoxel == 0; }
+        // Only meaningful when IsUniform()
+        uint16_t GetUniformBlock() const { return _palette[0]; }
+
+        int GetBitsPerVoxel() const { return _bitsPerVoxel; }
+        std::size_t GetPaletteSize() const { return _palette.size(); }
+        std::size_t GetMemoryUsage() const
+        {
+            std::size_t dataSize = IsUniform() ? 0 : ((std::size_t)CHUNK_VOLUME >> _wordShift) * sizeof(uint32_t);
+            return sizeof(ChunkData) + dataSize + _palette.capacity() * sizeof(uint16_t);
         }
 
-        uint16_t* m_voxels;
         glm::ivec3 m_offset;
+        std::shared_mutex m_mutex;
+        // Set by ChunkManager when the data came from WorldGen::GenerateChunkData rather than a save
+        bool m_generated = false;
+
+    private:
+        inline uint32_t GetRawValue(const uint32_t* data, int index) const
+        {
+            return (data[index >> _wordShift] >> ((index & _wordMask) << _bitsShift)) & _valueMask;
+        }
+
+        // Returns the palette slot for block, adding it and widening the storage if needed
+        uint32_t GetPaletteIndex(uint16_t block)
+        {
+            for (std::size_t i = 0; i < _palette.size(); i++)
+            {
+                if (_palette[i] == block)
+                    return (uint32_t)i;
+            }
+
+            if (_palette.size() == (1u << _bitsPerVoxel))
+            {
+                if (_bitsPerVoxel == 8)
+                {
+                    Resize(16);
+                    return block;
+                }
+                Resize(_bitsPerVoxel == 0 ? 1 : _bitsPerVoxel * 2);
+            }
+
+            _palette.push_back(block);
+            return (uint32_t)_palette.size() - 1;
+        }
+
+        // Repacks every voxel at the new width. Going to 16 bits resolves the palette.
+        void Resize(int bitsPerVoxel)
+        {
+            int bitsShift = Log2(bitsPerVoxel);
+            int wordShift = 5 - bitsShift;
+            int wordMask = (1 << wordShift) - 1;
+
+            uint32_t* data = static_cast<uint32_t*>(ChunkPools::GetVoxelPool(bitsPerVoxel).Allocate());
+            std::memset(data, 0, ((std::size_t)CHUNK_VOLUME >> wordShift) * sizeof(uint32_t));
+            bool resolvePalette = bitsPerVoxel == 16 && !_palette.empty();
+            for (int i = 0; i < CHUNK_VOLUME; i++)
+            {
+                uint32_t value = GetRawValue(_data, i);
+                if (resolvePalette)
+                    value = _palette[value];
+                data[i >> wordShift] |= value << ((i & wordMask) << bitsShift);
+            }
+
+            FreeData();
+            _data = data;
+            SetLayout(bitsPerVoxel);
+
+            if (bitsPerVoxel == 16)
+            {
+                _palette.clear();
+                _palette.shrink_to_fit();
+            }
+        }
+
+        // A uniform chunk has 0 bits per voxel: every index maps to word 0 with an
+        // empty value mask, so reads resolve to _palette[0] without a branch.
+        void SetLayout(int bitsPerVoxel)
+        {
+            _bitsPerVoxel = bitsPerVoxel;
+            if (bitsPerVoxel == 0)
+            {
+                _bitsShift = 0;
+                _wordShift = 31;
+                _wordMask = 0;
+                _valueMask = 0;
+                return;
+            }
+
+            _bitsShift = Log2(bitsPerVoxel);
+            _wordShift = 5 - _bitsShift;
+            _wordMask = (1 << _wordShift) - 1;
+            _valueMask = (1u << bitsPerVoxel) - 1;
+        }
+
+        static int Log2(int bitsPerVoxel)
+        {
+            int shift = 0;
+            while ((1 << shift) < bitsPerVoxel)
+                shift++;
+            return shift;
+        }
+
+        void FreeData()
+        {
+            if (_data != nullptr && _data != &_uniformWord)
+                ChunkPools::GetVoxelPool(_bitsPerVoxel).Free(_data);
+            _data = nullptr;
+        }
+
+        std::vector<uint16_t> _palette;
+        uint32_t* _data = nullptr;
+        uint32_t _uniformWord = 0;
+        int _bitsPerVoxel = 0;
+        int _bitsShift = 0;  // log2(_bitsPerVoxel)
+        int _wordShift = 0;  // log2(voxels per 32-bit word)
+        int _wordMask = 0;
+        uint32_t _valueMask = 0;
     };
 }
\ No newline at end of file
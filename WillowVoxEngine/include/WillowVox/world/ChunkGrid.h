@@ -0,0 +1,170 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <glm/glm.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace WillowVox
+{
+    /* Dense index of the chunks in a box around a center, addressed by chunk position modulo the
+       grid size. Each axis is a power of two, so a lookup is a few masks, one load and a position
+       check, and moving the center only refills the slots of positions that came into the box.
+
+       Only chunks inside the box are kept; Find returns nullptr for anything else, including a
+       slot that currently holds another position, so callers fall back to a full map on a miss.
+       GetPos returns the chunk position of a T. One thread writes, any thread can read, and the
+       owner must keep a T alive for readers after erasing it, as with ChunkMap. */
+    template <typename T, typename GetPos>
+    class ChunkGrid
+    {
+    public:
+        ChunkGrid() = default;
+        ~ChunkGrid()
+        {
+            delete _layout.load(std::memory_order_relaxed);
+            FreeRetired();
+        }
+
+        ChunkGrid(const ChunkGrid&) = delete;
+        ChunkGrid& operator=(const ChunkGrid&) = delete;
+
+        // Writer only. Publishes an empty grid holding a box halfExtent chunks out from the center on
+        // each axis, which the next SetCenter fills. Readers may still be using the old grid, so it's
+        // kept until FreeRetired.
+        void Resize(const glm::ivec3& halfExtent)
+        {
+            Layout* layout = new Layout(halfExtent);
+            if (Layout* previous = _layout.exchange(layout, std::memory_order_acq_rel))
+                _retiredLayouts.push_back(previous);
+            _filled = false;
+        }
+
+        // Writer only, once no reader can still be using a grid replaced by Resize
+        void FreeRetired()
+        {
+            for (Layout* layout : _retiredLayouts)
+                delete layout;
+            _retiredLayouts.clear();
+        }
+
+        bool Enabled() const { return _layout.load(std::memory_order_relaxed) != nullptr; }
+
+        // Writer only
+        glm::ivec3 GetHalfExtent() const
+        {
+            const Layout* layout = _layout.load(std::memory_order_relaxed);
+            return layout != nullptr ? layout->halfExtent : glm::ivec3(0);
+        }
+
+        // Any thread
+        T* Find(const glm::ivec3& pos) const
+        {
+            const Layout* layout = _layout.load(std::memory_order_acquire);
+            if (layout == nullptr)
+                return nullptr;
+            T* value = layout->slots[layout->GetIndex(pos)].load(std::memory_order_acquire);
+            return value != nullptr && GetPos()(*value) == pos ? value : nullptr;
+        }
+
+        // Writer only, ignored outside the box
+        void Insert(const glm::ivec3& pos, T* value)
+        {
+            Layout* layout = _layout.load(std::memory_order_relaxed);
+            if (layout != nullptr && _filled && layout->IsInBox(pos, _center))
+                layout->slots[layout->GetIndex(pos)].store(value, std::memory_order_release);
+        }
+
+        // Writer only
+        void Erase(const glm::ivec3& pos, T* value)
+        {
+            Layout* layout = _layout.load(std::memory_order_relaxed);
+            if (layout == nullptr)
+                return;
+            std::atomic<T*>& slot = layout->slots[layout->GetIndex(pos)];
+            if (slot.load(std::memory_order_relaxed) == value)
+                slot.store(nullptr, std::memory_order_release);
+        }
+
+        // Writer only. Positions that come into the box take their slot from find(pos), which
+        // returns the value at pos or nullptr. After a Resize the whole box is filled this way.
+        template <typename Find>
+        void SetCenter(const glm::ivec3& center, Find find)
+        {
+            Layout* layout = _layout.load(std::memory_order_relaxed);
+            if (layout == nullptr || (_filled && center == _center))
+                return;
+
+            glm::ivec3 previousCenter = _center;
+            bool refill = !_filled;
+            _center = center;
+            _filled = true;
+            const glm::ivec3& halfExtent = layout->halfExtent;
+            for (int x = center.x - halfExtent.x; x <= center.x + halfExtent.x; x++)
+            {
+                for (int y = center.y - halfExtent.y; y <= center.y + halfExtent.y; y++)
+                {
+                    for (int z = center.z - halfExtent.z; z <= center.z + halfExtent.z; z++)
+                    {
+                        glm::ivec3 pos(x, y, z);
+                        if (refill || !layout->IsInBox(pos, previousCenter))
+                            layout->slots[layout->GetIndex(pos)].store(find(pos), std::memory_order_release);
+                    }
+                }
+            }
+        }
+
+    private:
+        // Everything a reader needs, replaced as a whole by Resize
+        struct Layout
+        {
+            explicit Layout(const glm::ivec3& halfExtent)
+                : halfExtent(halfExtent), sizeBits(GetSizeBits(halfExtent.x), GetSizeBits(halfExtent.y), GetSizeBits(halfExtent.z)),
+                mask((1 << sizeBits.x) - 1, (1 << sizeBits.y) - 1, (1 << sizeBits.z) - 1),
+                slots(std::make_unique<std::atomic<T*>[]>((std::size_t)1 << (sizeBits.x + sizeBits.y + sizeBits.z)))
+            {
+                std::size_t slotCount = (std::size_t)1 << (sizeBits.x + sizeBits.y + sizeBits.z);
+                for (std::size_t i = 0; i < slotCount; i++)
+                    slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+
+            // Masking wraps negative positions too, the values are two's complement
+            std::size_t GetIndex(const glm::ivec3& pos) const
+            {
+                return ((std::size_t)(pos.x & mask.x) << (sizeBits.y + sizeBits.z))
+                    | ((std::size_t)(pos.y & mask.y) << sizeBits.z)
+                    | (std::size_t)(pos.z & mask.z);
+            }
+
+            bool IsInBox(const glm::ivec3& pos, const glm::ivec3& center) const
+            {
+                glm::ivec3 offset = glm::abs(pos - center);
+                return offset.x <= halfExtent.x && offset.y <= halfExtent.y && offset.z <= halfExtent.z;
+            }
+
+            glm::ivec3 halfExtent;
+            glm::ivec3 sizeBits;
+            glm::ivec3 mask;
+            std::unique_ptr<std::atomic<T*>[]> slots;
+        };
+
+        // Smallest power of two that fits the box's width
+        static int GetSizeBits(int halfExtent)
+        {
+            int bits = 0;
+            while ((1 << bits) < 2 * halfExtent + 1)
+                bits++;
+            return bits;
+        }
+
+        std::atomic<Layout*> _layout = nullptr;
+
+        // Owned by the writer
+        std::vector<Layout*> _retiredLayouts;
+        glm::ivec3 _center = { 0, 0, 0 };
+        bool _filled = false;
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstddef>
+
+namespace WillowVox
+{
+    /* Chunk positions waiting to be loaded, nearest first. Distance is weighted by the
+       angle to the view direction so chunks in front of the player load before the
+       ones behind it. Moving the view re-scores the queued chunks in place. */
+    class WILLOWVOX_API ChunkLoadQueue
+    {
+    public:
+        // Sets the position and direction chunks are scored from and re-scores everything queued
+        void SetView(const glm::vec3& position, const glm::vec3& front);
+
+        void Push(const glm::ivec3& pos);
+        glm::ivec3 Pop();
+
+        // Drops every queued chunk shouldRemove returns true for
+        template <typename Predicate>
+        void RemoveIf(Predicate shouldRemove)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < _heap.size(); i++)
+            {
+                if (!shouldRemove(_heap[i].pos))
+                    _heap[count++] = _heap[i];
+            }
+            if (count != _heap.size())
+            {
+                _heap.resize(count);
+                RebuildHeap();
+            }
+        }
+
+        void Clear() { _heap.clear(); }
+        bool Empty() const { return _heap.empty(); }
+        std::size_t Size() const { return _heap.size(); }
+
+        const glm::vec3& GetViewFront() const { return _viewFront; }
+
+        // Chunks straight behind the player score as 1 + 2 * VIEW_ANGLE_WEIGHT times further away
+        static constexpr float VIEW_ANGLE_WEIGHT = 1.0f;
+
+    private:
+        struct Entry
+        {
+            glm::ivec3 pos;
+            float score;
+        };
+
+        float Score(const glm::ivec3& pos) const;
+        static bool CompareEntries(const Entry& a, const Entry& b);
+        void RebuildHeap();
+
+        std::vector<Entry> _heap;
+        glm::vec3 _viewPos = { 0, 0, 0 };
+        glm::vec3 _viewFront = { 0, 0, -1 };
+    };
+}
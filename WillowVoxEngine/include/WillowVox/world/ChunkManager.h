@@ -3,18 +3,32 @@
 #include <WillowVox/WillowVoxDefines.h>
 #include <WillowVox/world/Chunk.h>
 #include <WillowVox/world/ChunkData.h>
+#include <WillowVox/world/ChunkLoadQueue.h>
+#include <WillowVox/world/ChunkMap.h>
+#include <WillowVox/world/ChunkGrid.h>
 #include <WillowVox/math/ivec3Hash.h>
 #include <WillowVox/rendering/Camera.h>
 #include <WillowVox/world/WorldGen.h>
+#include <WillowVox/world/WorldSave.h>
 #include <WillowVox/resources/Block.h>
 #include <glm/glm.hpp>
 #include <unordered_map>
-#include <queue>
+#include <unordered_set>
+#include <deque>
+#include <vector>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 
 namespace WillowVox
 {
+    /* Chunks are loaded by a pool of worker threads. The chunk thread decides what to
+       load and hands out generation and meshing jobs; a chunk is only meshed once its
+       own ChunkData and its six neighbors' exist. Meshed chunks are uploaded, and
+       unloaded chunks deleted, on the main thread in Update(). */
     class WILLOWVOX_API ChunkManager
     {
     public:
@@ -24,6 +38,12 @@ namespace WillowVox
         void Update();
         void Render(Camera& camera);
 
+        // Keeps chunks found from other threads alive, see ReadChunks
+        using ChunkReadGuard = ChunkMap<Chunk*>::ReadGuard;
+
+        // Lookups only see uploaded chunks. They never wait on the main thread and can be made from any
+        // thread, but off the main thread a chunk is only safe to use while a ReadChunks() guard is held.
+        ChunkReadGuard ReadChunks() const { return ChunkReadGuard(_chunks); }
         Chunk* GetChunk(int x, int y, int z);
         Chunk* GetChunk(glm::ivec3 pos);
         Chunk* GetChunkAtPos(float x, float y, float z);
@@ -34,12 +54,37 @@ namespace WillowVox
         Block* GetBlockAtPos(float x, float y, float z);
         Block* GetBlockAtPos(glm::vec3 pos);
 
+        // Sets the block at a world position in a loaded chunk, edits elsewhere are dropped.
+        // Inside an edit batch the edit waits for CommitEditBatch, otherwise it's remeshed right away.
+        void SetBlockAtPos(int x, int y, int z, uint16_t block);
+        // Edits until CommitEditBatch are grouped by chunk and applied with one lock per chunk,
+        // then every chunk they touch, neighbors included, is remeshed once
+        void BeginEditBatch();
+        void CommitEditBatch();
+
         void ClearChunkQueue();
 
         void SetPlayerObj(Camera* camera);
 
+        // Averaged over the last second, updated by Update()
+        float GetGeneratedChunksPerSecond() const { return _generatedChunksPerSecond; }
+        float GetMeshedChunksPerSecond() const { return _meshedChunksPerSecond; }
+
         int m_renderDistance = 10;
         int m_renderHeight = 2;
+        // Worker threads started by Start(), 0 uses hardware_concurrency - 2
+        int m_workerCount = 0;
+        // Index the chunks around the player in a ChunkGrid sized for the render distance and height,
+        // rebuilt when either changes.
+        // Lookups outside it, and everything when this is off, go through the hash maps.
+        bool m_useChunkGrid = true;
+        // Keep each chunk's spliced mesh data on the CPU after uploading it. The per section copies
+        // that partial remeshes need are kept either way.
+        bool m_retainCpuMesh = false;
+        // Chunks found in this save are loaded instead of generated, set before Start()
+        const WorldSave* m_worldSave = nullptr;
+        // Slab memory cap of ChunkPools, applied at Start()
+        std::size_t m_poolMemoryLimit = (std::size_t)1024 * 1024 * 1024;
 
         // TEMP until asset manager
         BaseMaterial* m_solidMaterial;
@@ -47,22 +92,102 @@ namespace WillowVox
         BaseMaterial* m_billboardMaterial;
 
     private:
+        struct ChunkJob
+        {
+            enum Type { GENERATE, MESH };
+
+            Type type;
+            glm::ivec3 pos;
+            Chunk* chunk = nullptr;         // MESH: the chunk to mesh
+            ChunkData* chunkData = nullptr; // GENERATE: the generated data
+        };
+
+        // A chunk waiting for neighbor data, or being meshed once missingData reaches 0
+        struct PendingChunk
+        {
+            Chunk* chunk;
+            int missingData;
+        };
+
         void ChunkThreadUpdate();
+        void WorkerThreadUpdate();
+        void PushJob(const ChunkJob& job);
+
+        // Queues every chunk in range, or with onlyEntered just the ones that weren't in range of previousPlayerChunk
+        void QueueChunksInRange(bool onlyEntered, const glm::ivec3& previousPlayerChunk);
+        void RequestChunk(const glm::ivec3& pos);
+        void DispatchMesh(PendingChunk& pending);
+        void OnChunkDataGenerated(const glm::ivec3& pos, ChunkData* chunkData);
+        void OnChunkMeshed(Chunk* chunk);
+        void UnloadChunks();
+        ChunkData* FindChunkData(const glm::ivec3& pos) const;
+        void InsertChunkData(const glm::ivec3& pos, ChunkData* chunkData);
+        // Lets the WorldGen release anything cached for generated data before deleting it
+        void DeleteChunkData(ChunkData* chunkData);
+        bool IsInRange(const glm::ivec3& pos, int padding) const;
+        bool IsChunkDataInUse(const glm::ivec3& pos) const;
 
         WorldGen& _worldGen;
 
-        std::unordered_map<glm::ivec3, Chunk*, ivec3Hash> _chunks;
+        struct ChunkGridPos
+        {
+            glm::ivec3 operator()(const Chunk& chunk) const { return chunk.m_chunkPos; }
+        };
+        struct ChunkDataGridPos
+        {
+            glm::ivec3 operator()(const ChunkData& chunkData) const { return chunkData.m_offset / CHUNK_SIZE; }
+        };
+
+        // Written by the main thread, read from any thread. The grid holds the chunks around the player.
+        ChunkMap<Chunk*> _chunks;
+        ChunkGrid<Chunk, ChunkGridPos> _chunkGrid;
+
+        // Owned by the main thread
+        std::unordered_map<glm::ivec3, std::vector<Chunk::BlockEdit>, ivec3Hash> _editBatch;
+        std::vector<Chunk::BlockEdit>* _lastEditChunk = nullptr; // Saves a lookup for runs of edits in one chunk
+        glm::ivec3 _lastEditChunkPos = { 0, 0, 0 };
+        bool _editBatchActive = false;
+
+        // Owned by the chunk thread
         std::unordered_map<glm::ivec3, ChunkData*, ivec3Hash> _chunkData;
-        std::queue<glm::ivec3> _chunkQueue; // For use only by chunk thread
+        ChunkGrid<ChunkData, ChunkDataGridPos> _chunkDataGrid;
+        std::unordered_set<glm::ivec3, ivec3Hash> _generatingData;
+        std::unordered_map<glm::ivec3, PendingChunk, ivec3Hash> _pendingChunks;
+        std::unordered_set<glm::ivec3, ivec3Hash> _loadedChunks;
+        ChunkLoadQueue _chunkQueue;
+        int _loadDistance = 0, _loadHeight = 0;
 
-        std::thread _chunkThread;
+        // Shared between the chunk thread and the main thread, guarded by _chunkMutex
+        std::vector<Chunk*> _chunkUploadQueue;
+        std::vector<glm::ivec3> _chunkUnloadQueue;
+        std::vector<ChunkData*> _chunkDataDeleteQueue;
+        glm::vec3 _targetPlayerPos = { 0, 0, 0 };
+        glm::vec3 _targetPlayerFront = { 0, 0, -1 };
+        int _targetLoadDistance = 0, _targetLoadHeight = 0;
         std::mutex _chunkMutex;
 
+        std::thread _chunkThread;
+        std::vector<std::thread> _workerThreads;
+        int _maxPendingChunks = 0;
+
+        std::deque<ChunkJob> _jobQueue;
+        std::mutex _jobMutex;
+        std::condition_variable _jobCondition;
+
+        std::vector<ChunkJob> _completedJobs;
+        std::mutex _completedJobMutex;
+        std::condition_variable _completedJobCondition;
+
+        std::atomic<uint64_t> _generatedChunkCount = 0;
+        std::atomic<uint64_t> _meshedChunkCount = 0;
+        uint64_t _lastGeneratedChunkCount = 0, _lastMeshedChunkCount = 0;
+        float _generatedChunksPerSecond = 0.0f, _meshedChunksPerSecond = 0.0f;
+        std::chrono::steady_clock::time_point _metricsStartTime;
+
         Camera* _playerObj;
-        int _lastPlayerX = -100, _lastPlayerY = -100, _lastPlayerZ = -100;
         int _playerChunkX = -100, _playerChunkY = -100, _playerChunkZ = -100;
 
-        bool _shouldEnd = false;
-        bool _shouldClearChunkQueue = false;
+        std::atomic<bool> _shouldEnd = false;
+        std::atomic<bool> _shouldClearChunkQueue = false;
     };
 }
\ No newline at end of file
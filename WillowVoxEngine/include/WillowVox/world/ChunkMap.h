@@ -0,0 +1,229 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace WillowVox
+{
+    /* Chunk position to value map that any number of threads can read while one thread writes.
+       Positions are spread over SHARD_COUNT shards, each an immutable sorted array. Writes copy
+       the shard, change the copy and publish it with one atomic store, so readers never wait
+       on a writer, they just see the old or the new shard.
+
+       Replaced shards, and anything the owner erased, must outlive every reader that could
+       still see them. Readers pin the map with a ReadGuard while using what they found, and
+       the writer calls Synchronize before freeing erased values: it waits for the readers
+       pinned before the call, then frees the replaced shards. */
+    template <typename T>
+    class ChunkMap
+    {
+    public:
+        static constexpr int SHARD_COUNT = 256;
+
+        // Keeps values found while it's alive from being freed
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(const ChunkMap& map) : _map(map), _epoch(map.Pin()) {}
+            ~ReadGuard() { _map.Unpin(_epoch); }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+        private:
+            const ChunkMap& _map;
+            uint32_t _epoch;
+        };
+
+        ChunkMap()
+        {
+            for (std::atomic<Shard*>& shard : _shards)
+                shard.store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~ChunkMap()
+        {
+            for (std::atomic<Shard*>& shard : _shards)
+                delete shard.load(std::memory_order_relaxed);
+            for (Shard* shard : _retiredShards)
+                delete shard;
+        }
+
+        ChunkMap(const ChunkMap&) = delete;
+        ChunkMap& operator=(const ChunkMap&) = delete;
+
+        // Any thread. Values are only safe to use after the call under a ReadGuard or on the writer thread.
+        T Find(const glm::ivec3& pos, T notFound = T()) const
+        {
+            ReadGuard guard(*this);
+            uint64_t key = GetKey(pos);
+            const Shard* shard = _shards[GetShardIndex(key)].load(std::memory_order_acquire);
+            if (shard == nullptr)
+                return notFound;
+
+            auto it = std::lower_bound(shard->begin(), shard->end(), key, [](const Entry& entry, uint64_t key) { return entry.key < key; });
+            return it != shard->end() && it->key == key ? it->value : notFound;
+        }
+
+        // Writer thread only, replaces the value at pos if there is one
+        void Insert(const glm::ivec3& pos, T value)
+        {
+            uint64_t key = GetKey(pos);
+            std::atomic<Shard*>& slot = _shards[GetShardIndex(key)];
+            Shard* shard = slot.load(std::memory_order_relaxed);
+
+            Shard* copy = shard != nullptr ? new Shard(*shard) : new Shard();
+            auto it = std::lower_bound(copy->begin(), copy->end(), key, [](const Entry& entry, uint64_t key) { return entry.key < key; });
+            if (it != copy->end() && it->key == key)
+                it->value = value;
+            else
+            {
+                copy->insert(it, { key, value });
+                _size++;
+            }
+            Publish(slot, shard, copy);
+        }
+
+        // Writer thread only, returns false if nothing was at pos
+        bool Erase(const glm::ivec3& pos, T* erased = nullptr)
+        {
+            uint64_t key = GetKey(pos);
+            std::atomic<Shard*>& slot = _shards[GetShardIndex(key)];
+            Shard* shard = slot.load(std::memory_order_relaxed);
+            if (shard == nullptr)
+                return false;
+
+            auto it = std::lower_bound(shard->begin(), shard->end(), key, [](const Entry& entry, uint64_t key) { return entry.key < key; });
+            if (it == shard->end() || it->key != key)
+                return false;
+
+            if (erased != nullptr)
+                *erased = it->value;
+            Shard* copy = new Shard(*shard);
+            copy->erase(copy->begin() + (it - shard->begin()));
+            _size--;
+            Publish(slot, shard, copy);
+            return true;
+        }
+
+        // Writer thread only, waits for every reader pinned before the call and frees replaced shards.
+        // Erased values can be freed once it returns.
+        void Synchronize()
+        {
+            uint32_t epoch = _epoch.load(std::memory_order_relaxed);
+            _epoch.store(epoch + 1, std::memory_order_seq_cst);
+            for (ReaderCount& readers : _readers)
+            {
+                while (readers.count[epoch & 1].load(std::memory_order_seq_cst) != 0)
+                    std::this_thread::yield();
+            }
+
+            for (Shard* shard : _retiredShards)
+                delete shard;
+            _retiredShards.clear();
+        }
+
+        // Writer thread only, calls visit(pos, value) for every entry in no particular order
+        template <typename Visit>
+        void ForEach(Visit visit) const
+        {
+            for (const std::atomic<Shard*>& slot : _shards)
+            {
+                const Shard* shard = slot.load(std::memory_order_relaxed);
+                if (shard == nullptr)
+                    continue;
+                for (const Entry& entry : *shard)
+                    visit(GetPos(entry.key), entry.value);
+            }
+        }
+
+        // Writer thread only
+        std::size_t Size() const { return _size; }
+
+    private:
+        struct Entry
+        {
+            uint64_t key;
+            T value;
+        };
+        using Shard = std::vector<Entry>;
+
+        // 21 bits per axis, so chunk positions within a million chunks of the origin
+        static uint64_t GetKey(const glm::ivec3& pos)
+        {
+            return ((uint64_t)(pos.x & 0x1fffff) << 42) | ((uint64_t)(pos.y & 0x1fffff) << 21) | (uint64_t)(pos.z & 0x1fffff);
+        }
+
+        static glm::ivec3 GetPos(uint64_t key)
+        {
+            // Shifting up and back down sign extends each axis
+            return glm::ivec3(
+                (int32_t)((uint32_t)(key >> 42) << 11) >> 11,
+                (int32_t)((uint32_t)(key >> 21 & 0x1fffff) << 11) >> 11,
+                (int32_t)((uint32_t)(key & 0x1fffff) << 11) >> 11);
+        }
+
+        // Neighboring chunks land in different shards so a moving player's writes spread out
+        static std::size_t GetShardIndex(uint64_t key)
+        {
+            return (std::size_t)((key * 0x9e3779b97f4a7c15ull) >> 56) % SHARD_COUNT;
+        }
+
+        void Publish(std::atomic<Shard*>& slot, Shard* shard, Shard* copy)
+        {
+            slot.store(copy, std::memory_order_release);
+            if (shard != nullptr)
+                _retiredShards.push_back(shard);
+        }
+
+        // Threads take reader counts in turn so concurrent readers rarely share a cache line
+        static std::size_t GetReaderStripe()
+        {
+            static std::atomic<std::size_t> nextStripe = 0;
+            thread_local std::size_t stripe = nextStripe++ % READER_STRIPES;
+            return stripe;
+        }
+
+        uint32_t Pin() const
+        {
+            // Retry if Synchronize flipped the epoch between reading it and counting this reader,
+            // it may have already seen that parity's count at 0
+            ReaderCount& readers = _readers[GetReaderStripe()];
+            while (true)
+            {
+                uint32_t epoch = _epoch.load(std::memory_order_seq_cst);
+                readers.count[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+                if (_epoch.load(std::memory_order_seq_cst) == epoch)
+                    return epoch;
+                readers.count[epoch & 1].fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        void Unpin(uint32_t epoch) const
+        {
+            _readers[GetReaderStripe()].count[epoch & 1].fetch_sub(1, std::memory_order_release);
+        }
+
+        std::atomic<Shard*> _shards[SHARD_COUNT];
+        std::size_t _size = 0;
+
+        // Owned by the writer
+        std::vector<Shard*> _retiredShards;
+
+        // Pinned readers per epoch parity
+        static constexpr int READER_STRIPES = 16;
+        struct alignas(64) ReaderCount
+        {
+            std::atomic<uint32_t> count[2] = {};
+        };
+
+        mutable std::atomic<uint32_t> _epoch = 0;
+        mutable ReaderCount _readers[READER_STRIPES];
+    };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace WillowVox
+{
+    /* Hands out blocks of one size carved from slabs of SLAB_SIZE bytes. Freed blocks go on a
+       free list and are handed out again before a new slab is made, so streaming chunks in and
+       out reuses the same memory instead of going through the heap every time. Slabs are only
+       released when the pool is destroyed.
+
+       Every pool's slabs count towards ChunkPools' memory limit. Past it, blocks come from the
+       heap and go back to it when freed. Thread safe. */
+    class WILLOWVOX_API SlabPool
+    {
+    public:
+        static constexpr std::size_t SLAB_SIZE = 1024 * 1024;
+
+        struct Stats
+        {
+            const char* name;
+            std::size_t blockSize;
+            std::size_t live;       // Blocks handed out, including overflow
+            std::size_t free;       // Blocks in slabs ready to hand out
+            std::size_t highWater;  // Most blocks live at once
+            std::size_t overflow;   // Live blocks that came from the heap
+            std::size_t slabBytes;
+        };
+
+        SlabPool(const char* name, std::size_t blockSize);
+        ~SlabPool();
+
+        SlabPool(const SlabPool&) = delete;
+        SlabPool& operator=(const SlabPool&) = delete;
+
+        void* Allocate();
+        void Free(void* block);
+
+        std::size_t GetBlockSize() const { return _blockSize; }
+        Stats GetStats() const;
+
+    private:
+        bool IsInSlab(const void* block) const;
+
+        const char* _name;
+        std::size_t _blockSize;
+        std::size_t _blocksPerSlab;
+
+        mutable std::mutex _mutex;
+        std::vector<char*> _slabs;  // Sorted by address
+        void* _freeList = nullptr;  // Each free block starts with a pointer to the next
+        char* _newestSlab = nullptr;
+        std::size_t _unusedInSlab = 0;  // Blocks never handed out at the end of _newestSlab
+        std::size_t _live = 0;
+        std::size_t _free = 0;
+        std::size_t _highWater = 0;
+        std::size_t _overflow = 0;
+    };
+
+    // The pools behind chunk allocations, shared by every ChunkManager
+    class WILLOWVOX_API ChunkPools
+    {
+    public:
+        static SlabPool& GetChunkPool();
+        static SlabPool& GetChunkDataPool();
+        // Packed voxel storage at 1, 2, 4, 8 or 16 bits per voxel
+        static SlabPool& GetVoxelPool(int bitsPerVoxel);
+
+        // Mesh data is pooled in power of two sizes up to MAX_POOLED_MESH_SIZE, bigger buffers use the heap
+        static constexpr std::size_t MIN_POOLED_MESH_SIZE = 1024;
+        static constexpr std::size_t MAX_POOLED_MESH_SIZE = 256 * 1024;
+        static void* AllocateMeshData(std::size_t size);
+        static void FreeMeshData(void* data, std::size_t size);
+
+        // Caps the slab memory of all pools together, defaults to 1 GB. Lowering it frees nothing,
+        // pools just stop growing.
+        static void SetMemoryLimit(std::size_t bytes);
+        static std::size_t GetMemoryLimit();
+        static std::size_t GetSlabMemory();
+
+        static std::vector<SlabPool::Stats> GetStats();
+    };
+
+    // Stateless allocator for the CPU side mesh vectors
+    template <typename T>
+    struct MeshAllocator
+    {
+        using value_type = T;
+
+        MeshAllocator() = default;
+        template <typename U>
+        MeshAllocator(const MeshAllocator<U>&) {}
+
+        T* allocate(std::size_t count) { return static_cast<T*>(ChunkPools::AllocateMeshData(count * sizeof(T))); }
+        void deallocate(T* data, std::size_t count) { ChunkPools::FreeMeshData(data, count * sizeof(T)); }
+
+        template <typename U>
+        bool operator==(const MeshAllocator<U>&) const { return true; }
+    };
+
+    template <typename T>
+    using MeshVector = std::vector<T, MeshAllocator<T>>;
+}
@@ -4,6 +4,10 @@
 #include <WillowVox/world/WorldGen.h>
 #include <WillowVox/math/NoiseSettings.h>
 #include <WillowVox/world/SurfaceFeature.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
 #include <cstdint>
 
 namespace WillowVox
@@ -20,16 +24,70 @@ namespace WillowVox
             m_caveNoiseSettings(caveNoiseSettings), m_caveNoiseLayers(caveNoiseLayers),
             m_oreNoiseSettings(oreNoiseSettings), m_oreNoiseLayers(oreNoiseLayers),
             m_surfaceFeatures(surfaceFeatures), m_surfaceFeatureCount(surfaceFeatureCount) {}
+        ~TerrainGen() override;
 
+        // A surface feature placed on the surface block at (x, y, z), m_surfaceFeatures[feature]
+        struct SurfaceFeatureAnchor
+        {
+            int x, y, z;
+            int feature;
+        };
+
+        // Surface heights of a chunk column, shared by every chunk generated in it
+        struct ColumnHeightmap
+        {
+            int surfaceBlocks[CHUNK_SIZE][CHUNK_SIZE];
+            int minSurfaceBlock, maxSurfaceBlock;
+            // Features anchored in this column, which may reach into neighboring columns
+            std::vector<SurfaceFeatureAnchor> featureAnchors;
+            int refCount = 0;
+            std::once_flag computed;
+        };
+
+        // Each chunk holds a reference to the heightmaps of its column and of the neighbors its surface
+        // features come from, from GenerateChunkData until OnChunkDataUnloaded. A heightmap is evicted once
+        // none are left.
         void GenerateChunkData(ChunkData& chunkData) override;
+        void OnChunkDataUnloaded(const ChunkData& chunkData) override;
+
+        // Returns the heightmap of the column holding chunkData, computing it on first use.
+        // Every call must be paired with a ReleaseHeightmap.
+        const ColumnHeightmap& AcquireHeightmap(const ChunkData& chunkData);
+        void ReleaseHeightmap(const ChunkData& chunkData);
+        // The same for the column whose first block is at (x, z)
+        const ColumnHeightmap& AcquireHeightmap(int x, int z);
+        void ReleaseHeightmap(int x, int z);
+
+        // SKY chunks are entirely above the surface and only get GetSkyBlock, UNDERGROUND chunks are entirely
+        // at or below it and skip the surface checks, MIXED chunks cross it
+        enum ChunkClass { SKY, UNDERGROUND, MIXED };
+        // Uses GetSurfaceBounds first, and the chunk's column heightmap only if those can't tell
+        ChunkClass ClassifyChunk(const ChunkData& chunkData);
+        // Classifies a chunk starting at height y over surfaces between minSurfaceBlock and maxSurfaceBlock
+        static ChunkClass ClassifyChunk(int y, int minSurfaceBlock, int maxSurfaceBlock)
+        {
+            if (y > maxSurfaceBlock)
+                return SKY;
+            if (y + CHUNK_SIZE - 1 <= minSurfaceBlock)
+                return UNDERGROUND;
+            return MIXED;
+        }
+
         // === Generation Steps ===
         /* These exist so that developers can change these behaviors
            without having to remake the whole GenerateChunkData function */
+
+        // Samples the cave and ore noise for the whole chunk in batches, so it picks blocks like
+        // GetBlockInColumn without calling it, IsCave, IsOre or GetOreBlock. Override it too if you override those.
         virtual void GenerateChunkBlocks(ChunkData& chunkData);
+        // Places the parts of every feature anchored in this or a neighboring column that land in this chunk,
+        // so features cross chunk borders without the neighbors having to be loaded
         virtual void GenerateSurfaceFeatures(ChunkData& chunkData);
         // ========================
 
         uint16_t GetBlock(int x, int y, int z) override;
+        // GetBlock for a column whose surface block is already known, used for chunk generation
+        virtual uint16_t GetBlockInColumn(int x, int y, int z, int surfaceBlock);
         // === Block Picking Functions ===
         /* These exist so that developers can change these behaviors
            without having to remake the whole GetBlock function */
@@ -49,6 +107,12 @@ namespace WillowVox
         virtual uint16_t IsOre(int x, int y, int z, int surfaceBlock);
         // Gets the block that the surface is on
         virtual int GetSurfaceBlock(int x, int z);
+        // GetSurfaceBlock for the CHUNK_SIZE x CHUNK_SIZE columns starting at (x, z), used for heightmaps.
+        // Batches the surface noise, so override it too if you override GetSurfaceBlock.
+        virtual void GetSurfaceBlocks(int x, int z, int (&surfaceBlocks)[CHUNK_SIZE][CHUNK_SIZE]);
+        // Lowest and highest surface block anywhere in the world, from the surface noise amplitudes and offsets.
+        // Override it too if you override GetSurfaceBlock.
+        virtual void GetSurfaceBounds(int& minSurfaceBlock, int& maxSurfaceBlock);
         // ===============================
 
         // === Surface Feature Placement ===
@@ -58,6 +122,8 @@ namespace WillowVox
         // Override to change the conditions of surface feature placement
         // Base function checks if it is a cave or not
         virtual bool IsValidSurfaceFeaturePlacement(int x, int y, int z, int surfaceBlock);
+        // Finds the features anchored in the column whose first block is at (x, z), once per column
+        virtual void FindSurfaceFeatureAnchors(int x, int z, const int (&surfaceBlocks)[CHUNK_SIZE][CHUNK_SIZE], std::vector<SurfaceFeatureAnchor>& anchors);
         // =================================
 
         NoiseSettings2D* m_surfaceNoiseSettings;
@@ -66,5 +132,103 @@ namespace WillowVox
         int m_surfaceNoiseLayers, m_caveNoiseLayers, m_oreNoiseLayers;
         SurfaceFeature* m_surfaceFeatures;
         int m_surfaceFeatureCount;
+
+    protected:
+        // GenerateChunkBlocks' voxel loop, calling GetSkyBlock, GetGroundBlock and GetCaveBlock on picker.
+        // GenerateChunkBlocks passes *this so they go through the vtable, TerrainGenT passes its Derived.
+        template <typename BlockPicker>
+        void FillChunkBlocks(ChunkData& chunkData, BlockPicker& picker);
+
+        // Fills isCave and ores for the CHUNK_SIZE x noiseHeight x CHUNK_SIZE voxels at the bottom of the chunk,
+        // ores holds the m_replaceBlock of the first ore layer above its threshold, or -1 if none are
+        void SampleCaveAndOreNoise(const ChunkData& chunkData, int noiseHeight, std::vector<uint8_t>& isCave, std::vector<int32_t>& ores);
+
+    private:
+        // Block offsets features reach from their anchors, and the columns around a chunk, relative
+        // to its own, whose anchors can reach into it
+        struct FeatureReach
+        {
+            int minY, maxY;
+            int minColumnX, maxColumnX, minColumnZ, maxColumnZ;
+        };
+        // False when no feature can reach the chunk, nothing needs its neighbors then
+        bool GetFeatureReach(const ChunkData& chunkData, FeatureReach& reach);
+        // Each chunk holds the heightmaps of those columns from GenerateChunkData until OnChunkDataUnloaded,
+        // so their anchors are found once rather than by every chunk of the column
+        void AcquireFeatureColumns(const ChunkData& chunkData);
+        void ReleaseFeatureColumns(const ChunkData& chunkData);
+
+        std::unordered_map<int64_t, ColumnHeightmap*> _heightmaps;
+        std::mutex _heightmapMutex;
     };
+
+    template <typename BlockPicker>
+    void TerrainGen::FillChunkBlocks(ChunkData& chunkData, BlockPicker& picker)
+    {
+        const ColumnHeightmap& heightmap = AcquireHeightmap(chunkData);
+        ChunkClass chunkClass = ClassifyChunk(chunkData.m_offset.y, heightmap.minSurfaceBlock, heightmap.maxSurfaceBlock);
+
+        // Nothing is below the surface, so no noise is needed
+        if (chunkClass == SKY)
+        {
+            int i = 0;
+            for (int x = 0; x < CHUNK_SIZE; x++)
+            {
+                for (int y = 0; y < CHUNK_SIZE; y++)
+                {
+                    for (int z = 0; z < CHUNK_SIZE; z++)
+                    {
+                        int worldX = x + chunkData.m_offset.x;
+                        int worldY = y + chunkData.m_offset.y;
+                        int worldZ = z + chunkData.m_offset.z;
+                        chunkData.SetBlockAtIndex(i, picker.GetSkyBlock(worldX, worldY, worldZ, heightmap.surfaceBlocks[x][z]));
+                        i++;
+                    }
+                }
+            }
+
+            ReleaseHeightmap(chunkData);
+            return;
+        }
+
+        // Cave and ore noise is only needed up to the highest surface block
+        int noiseHeight = std::clamp(heightmap.maxSurfaceBlock - chunkData.m_offset.y + 1, 0, CHUNK_SIZE);
+        std::vector<uint8_t> isCave;
+        std::vector<int32_t> ores;
+        SampleCaveAndOreNoise(chunkData, noiseHeight, isCave, ores);
+
+        int i = 0;
+        for (int x = 0; x < CHUNK_SIZE; x++)
+        {
+            for (int y = 0; y < CHUNK_SIZE; y++)
+            {
+                for (int z = 0; z < CHUNK_SIZE; z++)
+                {
+                    int worldX = x + chunkData.m_offset.x;
+                    int worldY = y + chunkData.m_offset.y;
+                    int worldZ = z + chunkData.m_offset.z;
+                    int surfaceBlock = heightmap.surfaceBlocks[x][z];
+
+                    // Same choices as GetBlockInColumn, with the noise already sampled
+                    uint16_t block;
+                    if (chunkClass == MIXED && worldY > surfaceBlock)
+                        block = picker.GetSkyBlock(worldX, worldY, worldZ, surfaceBlock);
+                    else
+                    {
+                        int noiseIndex = (x * noiseHeight + y) * CHUNK_SIZE + z;
+                        if (isCave[noiseIndex])
+                            block = picker.GetCaveBlock(worldX, worldY, worldZ, surfaceBlock);
+                        else if (ores[noiseIndex] > 0)
+                            block = ores[noiseIndex];
+                        else
+                            block = picker.GetGroundBlock(worldX, worldY, worldZ, surfaceBlock);
+                    }
+                    chunkData.SetBlockAtIndex(i, block);
+                    i++;
+                }
+            }
+        }
+
+        ReleaseHeightmap(chunkData);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <WillowVox/world/TerrainGen.h>
+
+namespace WillowVox
+{
+    /* TerrainGen for generators that know their own type, used as class MyGen : public TerrainGenT<MyGen>.
+       The chunk generation loop calls Derived's GetSkyBlock, GetGroundBlock and GetCaveBlock directly
+       instead of through the vtable, so they can inline into it. Everything else still uses the virtual
+       functions, so Derived must be the final class in the hierarchy. */
+    template <typename Derived>
+    class TerrainGenT : public TerrainGen
+    {
+    public:
+        using TerrainGen::TerrainGen;
+
+        void GenerateChunkBlocks(ChunkData& chunkData) override
+        {
+            InlineBlockPicker picker{ static_cast<Derived&>(*this) };
+            FillChunkBlocks(chunkData, picker);
+        }
+
+    private:
+        // Qualified calls skip virtual dispatch
+        struct InlineBlockPicker
+        {
+            Derived& gen;
+
+            uint16_t GetSkyBlock(int x, int y, int z, int surfaceBlock)
+            {
+                return gen.Derived::GetSkyBlock(x, y, z, surfaceBlock);
+            }
+
+            uint16_t GetGroundBlock(int x, int y, int z, int surfaceBlock)
+            {
+                return gen.Derived::GetGroundBlock(x, y, z, surfaceBlock);
+            }
+
+            uint16_t GetCaveBlock(int x, int y, int z, int surfaceBlock)
+            {
+                return gen.Derived::GetCaveBlock(x, y, z, surfaceBlock);
+            }
+        };
+    };
+}
@@ -14,23 +14,23 @@ namespace WillowVox
     class WILLOWVOX_API World
     {
     public:
-        ~World();
+        virtual ~World();
 
         void Start();
         void Update();
         void Render();
 
-        Camera* m_mainCamera;
-        ChunkManager* m_chunkManager;
+        Camera* m_mainCamera = nullptr;
+        ChunkManager* m_chunkManager = nullptr;
 
     private:
         // vvv Test code vvv
-        Shader* _solidShader;
-        Shader* _fluidShader;
-        Shader* _billboardShader;
-        BaseMaterial* _solidMaterial;
-        BaseMaterial* _fluidMaterial;
-        BaseMaterial* _billboardMaterial;
-        Texture* _tex;
+        Shader* _solidShader = nullptr;
+        Shader* _fluidShader = nullptr;
+        Shader* _billboardShader = nullptr;
+        BaseMaterial* _solidMaterial = nullptr;
+        BaseMaterial* _fluidMaterial = nullptr;
+        BaseMaterial* _billboardMaterial = nullptr;
+        Texture* _tex = nullptr;
     };
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace WillowVox
     {
     public:
         WorldGen(int seed) : m_seed(seed) {}
+        virtual ~WorldGen() = default;
 
         virtual void GenerateChunkData(ChunkData& chunkData)
         {
@@ -21,7 +22,7 @@ namespace WillowVox
                 {
                     for (int z = 0; z < CHUNK_SIZE; z++)
                     {
-                        chunkData.m_voxels[i] = GetBlock(x + chunkData.m_offset.x, y + chunkData.m_offset.y, z + chunkData.m_offset.z);
+                        chunkData.SetBlockAtIndex(i, GetBlock(x + chunkData.m_offset.x, y + chunkData.m_offset.y, z + chunkData.m_offset.z));
                         i++;
                     }
                 }
@@ -33,6 +34,10 @@ namespace WillowVox
             return 0;
         }
 
+        // Called before chunk data filled by GenerateChunkData is deleted, so anything
+        // cached for it can be released
+        virtual void OnChunkDataUnloaded(const ChunkData& chunkData) {}
+
         int m_seed;
     };
 }
\ No newline at end of file
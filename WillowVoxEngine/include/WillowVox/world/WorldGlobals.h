@@ -1,3 +1,4 @@
 #pragma once
 
-#define CHUNK_SIZE 32
\ No newline at end of file
+#define CHUNK_SIZE 32
+#define CHUNK_VOLUME (CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE)
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <WillowVox/WillowVoxDefines.h>
+#include <WillowVox/world/ChunkData.h>
+#include <glm/glm.hpp>
+#include <filesystem>
+
+namespace WillowVox
+{
+    /* A world save directory: world.dat holds the seed and chunks/ holds one file per
+       chunk, named by chunk position. Chunk files store the voxels as runs of block
+       ids in ChunkData index order. Everything is little endian. Files are written
+       to a temporary name first so a crash never leaves a half written chunk. */
+    class WILLOWVOX_API WorldSave
+    {
+    public:
+        WorldSave(const std::filesystem::path& directory) : m_directory(directory) {}
+
+        // Creates the directories and writes world.dat
+        bool Create(int seed) const;
+        bool LoadSeed(int& seed) const;
+
+        bool HasChunk(const glm::ivec3& chunkPos) const;
+        // Saves the chunk at chunkData.m_offset, holding its mutex shared
+        bool SaveChunkData(ChunkData& chunkData) const;
+        // Fills chunkData from the chunk at its m_offset, false if the chunk isn't
+        // saved or its file is invalid
+        bool LoadChunkData(ChunkData& chunkData) const;
+
+        std::filesystem::path GetChunkPath(const glm::ivec3& chunkPos) const;
+
+        std::filesystem::path m_directory;
+
+        static constexpr uint32_t WORLD_MAGIC = 0x44575657;  // "WVWD"
+        static constexpr uint32_t CHUNK_MAGIC = 0x4B435657;  // "WVCK"
+        static constexpr uint32_t VERSION = 1;
+    };
+}
@@ -1,299 +1,12 @@
-// Minimal stub implementations for WillowVoxEngine to allow compilation on Linux
-// This is a temporary solution for build issues - actual implementations would be needed for functionality
+// Stub implementations for engine pieces that aren't in this tree yet
 
-#include <WillowVox/core/Application.h>
-#include <WillowVox/world/TerrainGen.h>
-#include <WillowVox/rendering/Camera.h>
-#include <WillowVox/rendering/BaseMaterial.h>
-#include <WillowVox/rendering/RenderingAPI.h>
-#include <WillowVox/world/World.h>
-#include <WillowVox/resources/Blocks.h>
-#include <WillowVox/rendering/Window.h>
 #include <WillowVox/physics/Physics.h>
-#include <WillowVox/world/Chunk.h>
-#include <WillowVox/world/ChunkManager.h>
-#include <imgui/imgui.h>
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <iostream>
-#include <string>
-#include <csignal>
 
-// Global variable for signal handling
-static bool signal_received = false;
-
-// Signal handler for SIGSEGV
-void segfault_handler(int sig) {
-    signal_received = true;
-    std::cout << "\nCaught segmentation fault during initialization." << std::endl;
-    std::cout << "This is expected with the stub implementation." << std::endl;
-    std::cout << "Continuing with graceful shutdown..." << std::endl;
-    // Reset signal handler to default and exit gracefully
-    std::signal(SIGSEGV, SIG_DFL);
-    exit(0);
-}
-
-// Forward declarations for types that might not have headers
-namespace WillowVox {
-    class PostProcessingShader;
-    class Shader;
-    class Texture;
-    class Mesh;
-    class MeshRenderer;
-}
-
-// StandardWorld forward declaration
-class StandardWorld;
-
-// Forward declare the WindowStub so we can use it
-class WindowStub;
-
-namespace WillowVox {
-
-// Window class stubs - define before using
-class WindowStub : public Window {
-public:
-    // Constructor and destructor stubs
-    WindowStub() { std::cout << "WindowStub: Created" << std::endl; }
-    ~WindowStub() { std::cout << "WindowStub: Destroyed" << std::endl; }
-    
-    // Required pure virtual methods from Window.h
-    void FrameStart() override { std::cout << "WindowStub: FrameStart" << std::endl; }
-    void PostProcessingStart() override { std::cout << "WindowStub: PostProcessingStart" << std::endl; }
-    void PostProcessingEnd() override { std::cout << "WindowStub: PostProcessingEnd" << std::endl; }
-    void UIStart() override { std::cout << "WindowStub: UIStart" << std::endl; }
-    void UIEnd() override { std::cout << "WindowStub: UIEnd" << std::endl; }
-    void FrameEnd() override { std::cout << "WindowStub: FrameEnd" << std::endl; }
-    void CloseWindow() override { std::cout << "WindowStub: CloseWindow" << std::endl; }
-    void SetBackgroundColor(glm::vec4 color) override { 
-        std::cout << "WindowStub: Set background color (vec4)" << std::endl;
+namespace WillowVox::Physics
+{
+    // Never hits anything
+    RaycastResult Raycast(ChunkManager& chunkManager, glm::vec3 origin, glm::vec3 direction, float maxDistance)
+    {
+        return RaycastResult(false, glm::vec3(0), nullptr, 0, 0, 0, 0, 0, 0);
     }
-    
-    // Additional required virtual methods
-    void SetBackgroundColor(float r, float g, float b, float a) override { 
-        std::cout << "Window: Set background color (" << r << ", " << g << ", " << b << ", " << a << ")" << std::endl;
-    }
-    void SetMouseDisabled(bool state) override {
-        std::cout << "Window: Mouse disabled = " << (state ? "true" : "false") << std::endl;
-    }
-    void ToggleMouseDisabled() override { std::cout << "Window: Toggle mouse disabled" << std::endl; }
-    bool ShouldClose() override { return false; }
-    glm::ivec2 GetWindowSize() override { return glm::ivec2(1920, 1080); }
-    bool KeyDown(WillowVox::Key key) override { return false; }
-    bool MouseButtonDown(int button) override { return false; }
-    glm::vec2 GetMousePos() override { return glm::vec2(0, 0); }
-    bool MouseDisabled() override { return false; }
-};
-
-// Application class stubs
-Application::Application() {
-    std::cout << "WillowVox Application initializing..." << std::endl;
-    // Initialize actual stub objects instead of placeholder pointers
-    _window = new WindowStub();
-    _renderingAPI = reinterpret_cast<RenderingAPI*>(1); // Still use placeholder for RenderingAPI
-}
-
-Application::~Application() {
-    std::cout << "WillowVox Application shutting down..." << std::endl;
-    delete _window; // Clean up the WindowStub we created
-}
-
-void Application::Run() {
-    std::cout << "WillowVox Application starting..." << std::endl;
-    
-    try {
-        // Call the application lifecycle methods that ScuffedMinecraft implements
-        std::cout << "Loading assets..." << std::endl;
-        LoadAssets();
-        
-        std::cout << "Registering blocks..." << std::endl;
-        RegisterBlocks();
-        
-        std::cout << "Starting application..." << std::endl;
-        std::cout << "Calling ScuffedMinecraft::Start() - Note: may encounter issues with stub implementation" << std::endl;
-        
-        // Set up signal handler for segfaults
-        signal_received = false;
-        std::signal(SIGSEGV, segfault_handler);
-        
-        // Try to call Start() - signal handler will exit gracefully if segfault occurs
-        Start();
-        
-        std::cout << "Application started successfully!" << std::endl;
-        
-        std::cout << std::endl;
-        std::cout << "=== APPLICATION RUNNING ===" << std::endl;
-        std::cout << "ScuffedMinecraft has initialized and would now enter the main game loop." << std::endl;
-        std::cout << "On a full implementation, this would display a 3D Minecraft-like world." << std::endl;
-        
-        // Reset signal handler
-        std::signal(SIGSEGV, SIG_DFL);
-        
-        std::cout << std::endl;
-        std::cout << "=== STUB IMPLEMENTATION NOTICE ===" << std::endl;
-        std::cout << "This is a stub implementation of the WillowVox engine for Linux compatibility." << std::endl;
-        std::cout << "The application has initialized successfully and is now ready to run." << std::endl;
-        std::cout << "However, full game functionality (graphics, input, world generation) requires" << std::endl;
-        std::cout << "a complete implementation of the WillowVox engine." << std::endl;
-        std::cout << "====================================" << std::endl;
-        
-    } catch (const std::exception& e) {
-        std::cerr << "Error during application startup: " << e.what() << std::endl;
-    } catch (...) {
-        std::cerr << "Unknown error during application startup" << std::endl;
-    }
-}
-
-ImGuiContext* Application::GetImGuiContext() { return nullptr; }
-
-// TerrainGen class stubs
-void TerrainGen::GenerateChunkData(ChunkData& chunkData) {}
-uint16_t TerrainGen::GetBlock(int x, int y, int z) { return 0; }
-void TerrainGen::GenerateChunkBlocks(ChunkData& chunkData) {}
-void TerrainGen::GenerateSurfaceFeatures(ChunkData& chunkData) {}
-uint16_t TerrainGen::GetSkyBlock(int x, int y, int z, int surfaceBlock) { return 0; }
-uint16_t TerrainGen::GetGroundBlock(int x, int y, int z, int surfaceBlock) { return 0; }
-uint16_t TerrainGen::GetCaveBlock(int x, int y, int z, int surfaceBlock) { return 0; }
-uint16_t TerrainGen::GetOreBlock(int x, int y, int z, int surfaceBlock, uint16_t block) { return block; }
-bool TerrainGen::IsCave(int x, int y, int z, int surfaceBlock) { return false; }
-uint16_t TerrainGen::IsOre(int x, int y, int z, int surfaceBlock) { return 0; }
-int TerrainGen::GetSurfaceBlock(int x, int z) { return 0; }
-bool TerrainGen::IsValidSurfaceFeaturePlacement(int x, int y, int z, int surfaceBlock) { return true; }
-
-// Camera class stubs
-Camera::Camera(Window* window, glm::vec3 position, glm::vec3 direction) {
-    std::cout << "Camera: Created with window, position, and direction" << std::endl;
-}
-Camera::Camera(Window* window, float posX, float posY, float posZ, float roll, float pitch, float yaw) {
-    std::cout << "Camera: Created with window and float parameters" << std::endl;
-}
-glm::vec3 Camera::Front() { return glm::vec3(0.0f, 0.0f, -1.0f); }
-glm::vec3 Camera::Right() { return glm::vec3(1.0f, 0.0f, 0.0f); }
-glm::vec3 Camera::Up() { return glm::vec3(0.0f, 1.0f, 0.0f); }
-glm::mat4 Camera::GetProjectionMatrix() { return glm::mat4(1.0f); }
-glm::mat4 Camera::GetViewMatrix() { return glm::mat4(1.0f); }
-
-// BaseMaterial class stubs
-BaseMaterial::BaseMaterial(Shader* shader) {}
-
-// RenderingAPI static member
-RenderingAPI* RenderingAPI::m_renderingAPI = nullptr;
-
-// RenderingAPI method stubs
-void RenderingAPI::SetCullFace(bool enabled) {
-    std::cout << "RenderingAPI: Set cull face = " << (enabled ? "true" : "false") << std::endl;
-}
-void RenderingAPI::SetDepthTest(bool enabled) {
-    std::cout << "RenderingAPI: Set depth test = " << (enabled ? "true" : "false") << std::endl;
-}
-void RenderingAPI::SetLineWidth(float width) {
-    std::cout << "RenderingAPI: Set line width = " << width << std::endl;
-}
-void RenderingAPI::SetVsync(bool enabled) {
-    std::cout << "RenderingAPI: Set vsync = " << (enabled ? "true" : "false") << std::endl;
-}
-WillowVox::Shader* RenderingAPI::CreateShader(const char* vertexPath, const char* fragmentPath) {
-    std::cout << "RenderingAPI: Creating shader with vertex: " << vertexPath << ", fragment: " << fragmentPath << std::endl;
-    return reinterpret_cast<WillowVox::Shader*>(1); // Non-null placeholder
 }
-WillowVox::Texture* RenderingAPI::CreateTexture(const char* path) {
-    std::cout << "RenderingAPI: Creating texture from: " << path << std::endl;
-    return reinterpret_cast<WillowVox::Texture*>(1); // Non-null placeholder
-}
-WillowVox::Mesh* RenderingAPI::CreateMesh() {
-    std::cout << "RenderingAPI: Creating mesh" << std::endl;
-    return reinterpret_cast<WillowVox::Mesh*>(1); // Non-null placeholder
-}
-
-// World class stubs
-World::~World() {}
-
-// Blocks class stubs
-void Blocks::RegisterBlock(Block block) {}
-Block& Blocks::GetBlock(uint16_t id) { 
-    static Block dummy(0, 0, Block::SOLID, "dummy"); 
-    return dummy; 
-}
-Block& Blocks::GetBlock(const char* name) { 
-    static Block dummy(0, 0, Block::SOLID, "dummy"); 
-    return dummy; 
-}
-// Static member for blocks
-std::vector<Block> Blocks::blocks;
-
-// Window class stubs
-void Window::AddPostProcessingShader(PostProcessingShader* shader) {
-    std::cout << "Window: AddPostProcessingShader called" << std::endl;
-}
-
-// Physics namespace stubs
-namespace Physics {
-    RaycastResult Raycast(ChunkManager& chunkManager, glm::vec3 origin, glm::vec3 direction, float maxDistance) { 
-        return RaycastResult(false, glm::vec3(0), nullptr, 0, 0, 0, 0, 0, 0); 
-    }
-}
-
-// Chunk class stubs
-void Chunk::SetBlock(int x, int y, int z, uint16_t blockId) {}
-uint16_t Chunk::GetBlockIdAtPos(int x, int y, int z) { return 0; }
-
-// ChunkManager class stubs
-Chunk* ChunkManager::GetChunk(int x, int y, int z) { return nullptr; }
-uint16_t ChunkManager::GetBlockIdAtPos(glm::vec3 position) { return 0; }
-void ChunkManager::ClearChunkQueue() {}
-
-// Additional stubs for classes used in ScuffedMinecraft::Start()
-namespace WillowVox {
-
-// Shader class stubs
-class Shader {
-public:
-    void Bind() { std::cout << "Shader: Bind called" << std::endl; }
-    void SetMat4(const std::string& name, const glm::mat4& mat) { 
-        std::cout << "Shader: SetMat4 called for: " << name << std::endl; 
-    }
-};
-
-// Texture class stubs  
-class Texture {
-public:
-    Texture() { std::cout << "Texture: Created" << std::endl; }
-};
-
-// Mesh class stubs
-class Mesh {
-public:
-    void SetMesh(void* vertices, size_t vertexSize, int vertexCount, uint32_t* indices, int indexCount) {
-        std::cout << "Mesh: SetMesh called with " << vertexCount << " vertices, " << indexCount << " indices" << std::endl;
-    }
-};
-
-// MeshRenderer class stubs
-class MeshRenderer {
-public:
-    MeshRenderer(const BaseMaterial& material) { 
-        std::cout << "MeshRenderer: Created with material" << std::endl; 
-    }
-    void SetMesh(Mesh* mesh, bool deleteMesh) { 
-        std::cout << "MeshRenderer: SetMesh called" << std::endl; 
-    }
-    void Render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& position, int mode) {
-        std::cout << "MeshRenderer: Render called" << std::endl;
-    }
-    void Render(const glm::vec3& position) {
-        std::cout << "MeshRenderer: Render called with position" << std::endl;
-    }
-};
-
-// PostProcessingShader class stubs
-class PostProcessingShader {
-public:
-    bool enabled = false;
-    PostProcessingShader(Shader* shader, bool enabled) : enabled(enabled) {
-        std::cout << "PostProcessingShader: Created" << std::endl;
-    }
-};
-
-} // namespace WillowVox
-
-} // namespace WillowVox
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <WillowVox/core/Application.h>
+#include <WillowVox/core/Logger.h>
+#include <WillowVox/math/Noise.h>
+
+namespace WillowVox
+{
+	Application::Application()
+	{
+		Noise::InitNoise();
+
+		_renderingAPI = RenderingAPI::GetRenderingAPI();
+		RenderingAPI::m_renderingAPI = _renderingAPI;
+		_window = nullptr;
+		m_world = nullptr;
+		m_deltaTime = 0;
+	}
+
+	Application::~Application()
+	{
+		// The world's chunks delete their meshes, so it goes before the window and API
+		delete m_world;
+		delete _window;
+		RenderingAPI::m_renderingAPI = nullptr;
+		delete _renderingAPI;
+	}
+
+	void Application::Run()
+	{
+		_window = _renderingAPI->CreateWindow(_defaultWindowWidth, _defaultWindowHeight, _applicationName);
+
+		LoadAssets();
+		RegisterBlocks();
+		Start();
+		m_world->Start();
+
+		_lastFrame = _renderingAPI->GetTime();
+		double startTime = _lastFrame;
+		int frames = 0;
+		while (!_window->ShouldClose())
+		{
+			double currentFrame = _renderingAPI->GetTime();
+			m_deltaTime = (float)(currentFrame - _lastFrame);
+			_lastFrame = currentFrame;
+
+			_window->FrameStart();
+
+			m_world->Update();
+			Update();
+
+			ConfigurePostProcessing();
+			if (_postProcessingEnabled)
+				_window->PostProcessingStart();
+
+			m_world->Render();
+			Render();
+
+			if (_postProcessingEnabled)
+				_window->PostProcessingEnd();
+
+			if (_renderUI)
+			{
+				_window->UIStart();
+				RenderUI();
+				_window->UIEnd();
+			}
+
+			_window->FrameEnd();
+			frames++;
+		}
+
+		double runTime = _renderingAPI->GetTime() - startTime;
+		Logger::EngineLog("Ran %d frames in %.2f s, %.1f fps", frames, runTime, runTime > 0 ? frames / runTime : 0.0);
+	}
+
+	ImGuiContext* Application::GetImGuiContext()
+	{
+		return ImGui::GetCurrentContext();
+	}
+}
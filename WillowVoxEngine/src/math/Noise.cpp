@@ -0,0 +1,353 @@
+#include <WillowVox/math/Noise.h>
+#include "NoiseKernels.h"
+#include <algorithm>
+#include <vector>
+
+#ifdef WILLOWVOX_NOISE_SIMD
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#endif
+
+namespace WillowVox
+{
+    static Noise::SimdLevel simdLevel = Noise::SCALAR;
+    static NoiseKernels::PerlinRow2DKernel perlinRow2D = NoiseKernels::PerlinRow2DScalar;
+    static NoiseKernels::PerlinRow3DKernel perlinRow3D = NoiseKernels::PerlinRow3DScalar;
+
+    // Settings frequencies are in units of 1/100 blocks
+    static constexpr float FREQUENCY_SCALE = 0.01f;
+
+    // Adds one octave of noise * amplitude to value, single sample rows of the scalar kernels
+    static void AddOctave(int seed, float frequency, float amplitude, float& value, float x, float y)
+    {
+        NoiseKernels::PerlinRow2DScalar(seed, frequency, amplitude, x, &y, 1, &value);
+    }
+
+    static void AddOctave(int seed, float frequency, float amplitude, float& value, float x, float y, float z)
+    {
+        NoiseKernels::PerlinRow3DScalar(seed, frequency, amplitude, x, y, &z, 1, &value);
+    }
+
+    // Sums settings.m_octaves octaves of noise, normalized by the total octave amplitude to [-1, 1]
+    template <typename Settings, typename... Coords>
+    static float GetOctaveNoise(Settings& settings, int seed, Coords... coords)
+    {
+        float value = 0.0f;
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = settings.m_frequency;
+        for (int i = 0; i < settings.m_octaves; i++)
+        {
+            AddOctave(seed, frequency * FREQUENCY_SCALE, amplitude, value, coords...);
+            maxValue += amplitude;
+
+            amplitude *= settings.m_persistence;
+            frequency *= settings.m_lacunarity;
+        }
+
+        return maxValue > 0.0f ? value / maxValue : 0.0f;
+    }
+
+    // Fills out with settings.m_octaves octaves of noise over a grid like GetOctaveNoise, one row of samples at a time
+    template <typename Settings>
+    static void GetOctaveNoiseGrid(Settings& settings, int seed, float x, float y, int sizeX, int sizeY, float step, float* out)
+    {
+        std::fill(out, out + sizeX * sizeY, 0.0f);
+
+        // Offsets are added before scaling, as in the single sample path
+        std::vector<float> ys(sizeY);
+        for (int i = 0; i < sizeY; i++)
+            ys[i] = (y + i * step) + settings.m_yOffset;
+
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = settings.m_frequency;
+        for (int i = 0; i < settings.m_octaves; i++)
+        {
+            for (int ix = 0; ix < sizeX; ix++)
+                perlinRow2D(seed, frequency * FREQUENCY_SCALE, amplitude, (x + ix * step) + settings.m_xOffset, ys.data(), sizeY, out + ix * sizeY);
+            maxValue += amplitude;
+
+            amplitude *= settings.m_persistence;
+            frequency *= settings.m_lacunarity;
+        }
+
+        for (int i = 0; i < sizeX * sizeY; i++)
+            out[i] = maxValue > 0.0f ? out[i] / maxValue : 0.0f;
+    }
+
+    template <typename Settings>
+    static void GetOctaveNoiseGrid(Settings& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float step, float* out)
+    {
+        std::fill(out, out + sizeX * sizeY * sizeZ, 0.0f);
+
+        std::vector<float> zs(sizeZ);
+        for (int i = 0; i < sizeZ; i++)
+            zs[i] = (z + i * step) + settings.m_zOffset;
+
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = settings.m_frequency;
+        for (int i = 0; i < settings.m_octaves; i++)
+        {
+            for (int ix = 0; ix < sizeX; ix++)
+            {
+                for (int iy = 0; iy < sizeY; iy++)
+                {
+                    perlinRow3D(seed, frequency * FREQUENCY_SCALE, amplitude, (x + ix * step) + settings.m_xOffset, (y + iy * step) + settings.m_yOffset,
+                        zs.data(), sizeZ, out + (ix * sizeY + iy) * sizeZ);
+                }
+            }
+            maxValue += amplitude;
+
+            amplitude *= settings.m_persistence;
+            frequency *= settings.m_lacunarity;
+        }
+
+        for (int i = 0; i < sizeX * sizeY * sizeZ; i++)
+            out[i] = (maxValue > 0.0f ? out[i] / maxValue : 0.0f) * settings.m_amplitude;
+    }
+
+    static int FloorDiv(int a, int b)
+    {
+        return a / b - (a % b != 0 && (a < 0) != (b < 0));
+    }
+
+    static float Lerp(float a, float b, float t)
+    {
+        return a + t * (b - a);
+    }
+
+    template <typename Settings>
+    static float GetUpsampledValue(Settings& settings, int seed, int x, int y, int z)
+    {
+        int step = settings.m_sampleStep;
+        if (step <= 1)
+            return Noise::GetValue3D(settings, seed, x, y, z);
+
+        int x0 = FloorDiv(x, step) * step;
+        int y0 = FloorDiv(y, step) * step;
+        int z0 = FloorDiv(z, step) * step;
+        float tx = (x - x0) / (float)step;
+        float ty = (y - y0) / (float)step;
+        float tz = (z - z0) / (float)step;
+
+        // Same order of operations as GetUpsampledValues
+        float rows[2];
+        for (int i = 0; i < 2; i++)
+        {
+            int cz = z0 + i * step;
+            float y0Value = Lerp(Noise::GetValue3D(settings, seed, x0, y0, cz), Noise::GetValue3D(settings, seed, x0 + step, y0, cz), tx);
+            float y1Value = Lerp(Noise::GetValue3D(settings, seed, x0, y0 + step, cz), Noise::GetValue3D(settings, seed, x0 + step, y0 + step, cz), tx);
+            rows[i] = Lerp(y0Value, y1Value, ty);
+        }
+        return Lerp(rows[0], rows[1], tz);
+    }
+
+    template <typename Settings>
+    static void GetUpsampledValues(Settings& settings, int seed, int x, int y, int z, int sizeX, int sizeY, int sizeZ, float* out)
+    {
+        int step = settings.m_sampleStep;
+        if (step <= 1)
+        {
+            Noise::GetValues3D(settings, seed, x, y, z, sizeX, sizeY, sizeZ, out);
+            return;
+        }
+
+        // Lattice points around the whole grid, one past the last cell on each axis
+        int cellX = FloorDiv(x, step), cellY = FloorDiv(y, step), cellZ = FloorDiv(z, step);
+        int latticeX = FloorDiv(x + sizeX - 1, step) - cellX + 2;
+        int latticeY = FloorDiv(y + sizeY - 1, step) - cellY + 2;
+        int latticeZ = FloorDiv(z + sizeZ - 1, step) - cellZ + 2;
+        std::vector<float> lattice(latticeX * latticeY * latticeZ);
+        Noise::GetValues3D(settings, seed, cellX * step, cellY * step, cellZ * step, latticeX, latticeY, latticeZ, lattice.data(), step);
+
+        // Interpolates x and y once per lattice z, then z per sample
+        std::vector<float> rows(latticeZ);
+        for (int ix = 0; ix < sizeX; ix++)
+        {
+            int lx = x + ix - cellX * step;
+            float tx = (lx % step) / (float)step;
+            const float* x0 = &lattice[(lx / step) * latticeY * latticeZ];
+            const float* x1 = x0 + latticeY * latticeZ;
+            for (int iy = 0; iy < sizeY; iy++)
+            {
+                int ly = y + iy - cellY * step;
+                float ty = (ly % step) / (float)step;
+                int row = (ly / step) * latticeZ;
+                for (int k = 0; k < latticeZ; k++)
+                {
+                    float y0Value = Lerp(x0[row + k], x1[row + k], tx);
+                    float y1Value = Lerp(x0[row + latticeZ + k], x1[row + latticeZ + k], tx);
+                    rows[k] = Lerp(y0Value, y1Value, ty);
+                }
+
+                float* outRow = out + (ix * sizeY + iy) * sizeZ;
+                for (int iz = 0; iz < sizeZ; iz++)
+                {
+                    int lz = z + iz - cellZ * step;
+                    outRow[iz] = Lerp(rows[lz / step], rows[lz / step + 1], (lz % step) / (float)step);
+                }
+            }
+        }
+    }
+
+    // The best level this CPU and OS can run
+    static Noise::SimdLevel GetSupportedSimdLevel()
+    {
+#ifdef WILLOWVOX_NOISE_SIMD
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 1);
+        bool sse41 = (info[2] & (1 << 19)) != 0;
+        // AVX needs the OS to save the ymm registers
+        bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        bool avx2 = avx && (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        bool sse41 = __builtin_cpu_supports("sse4.1");
+        bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+        if (avx2)
+            return Noise::AVX2;
+        if (sse41)
+            return Noise::SSE41;
+#endif
+        return Noise::SCALAR;
+    }
+
+    void Noise::InitNoise()
+    {
+        SetSimdLevel(AVX2);
+    }
+
+    Noise::SimdLevel Noise::GetSimdLevel()
+    {
+        return simdLevel;
+    }
+
+    void Noise::SetSimdLevel(SimdLevel level)
+    {
+        simdLevel = std::min(level, GetSupportedSimdLevel());
+        switch (simdLevel)
+        {
+#ifdef WILLOWVOX_NOISE_SIMD
+        case AVX2:
+            perlinRow2D = NoiseKernels::PerlinRow2DAVX2;
+            perlinRow3D = NoiseKernels::PerlinRow3DAVX2;
+            break;
+        case SSE41:
+            perlinRow2D = NoiseKernels::PerlinRow2DSSE41;
+            perlinRow3D = NoiseKernels::PerlinRow3DSSE41;
+            break;
+#endif
+        default:
+            perlinRow2D = NoiseKernels::PerlinRow2DScalar;
+            perlinRow3D = NoiseKernels::PerlinRow3DScalar;
+            break;
+        }
+    }
+
+    const char* Noise::GetSimdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case AVX2:
+            return "AVX2";
+        case SSE41:
+            return "SSE4.1";
+        default:
+            return "Scalar";
+        }
+    }
+
+    float Noise::GetValue2D(NoiseSettings2D& settings, int seed, float x, float y)
+    {
+        // Heightmap noise is remapped to [0, 1] so m_amplitude is the full height range
+        float value = (GetOctaveNoise(settings, seed, x + settings.m_xOffset, y + settings.m_yOffset) + 1.0f) / 2.0f;
+        return value * settings.m_amplitude + settings.m_heightOffset;
+    }
+
+    float Noise::GetValueLayered2D(NoiseSettings2D* settings, int layers, int seed, float x, float y)
+    {
+        float value = 0.0f;
+        for (int i = 0; i < layers; i++)
+            value += GetValue2D(settings[i], seed, x, y);
+        return value;
+    }
+
+    float Noise::GetValue3D(NoiseSettings3D& settings, int seed, float x, float y, float z)
+    {
+        float value = GetOctaveNoise(settings, seed, x + settings.m_xOffset, y + settings.m_yOffset, z + settings.m_zOffset);
+        return value * settings.m_amplitude;
+    }
+
+    float Noise::GetValue3D(CaveNoiseSettings& settings, int seed, float x, float y, float z)
+    {
+        float value = GetOctaveNoise(settings, seed, x + settings.m_xOffset, y + settings.m_yOffset, z + settings.m_zOffset);
+        return value * settings.m_amplitude;
+    }
+
+    float Noise::GetValue3D(OreNoiseSettings& settings, int seed, float x, float y, float z)
+    {
+        float value = GetOctaveNoise(settings, seed, x + settings.m_xOffset, y + settings.m_yOffset, z + settings.m_zOffset);
+        return value * settings.m_amplitude;
+    }
+
+    void Noise::GetValues2D(NoiseSettings2D& settings, int seed, float x, float y, int sizeX, int sizeY, float* out, float step)
+    {
+        GetOctaveNoiseGrid(settings, seed, x, y, sizeX, sizeY, step, out);
+        for (int i = 0; i < sizeX * sizeY; i++)
+            out[i] = (out[i] + 1.0f) / 2.0f * settings.m_amplitude + settings.m_heightOffset;
+    }
+
+    void Noise::GetValuesLayered2D(NoiseSettings2D* settings, int layers, int seed, float x, float y, int sizeX, int sizeY, float* out, float step)
+    {
+        std::fill(out, out + sizeX * sizeY, 0.0f);
+        std::vector<float> layer(sizeX * sizeY);
+        for (int i = 0; i < layers; i++)
+        {
+            GetValues2D(settings[i], seed, x, y, sizeX, sizeY, layer.data(), step);
+            for (int j = 0; j < sizeX * sizeY; j++)
+                out[j] += layer[j];
+        }
+    }
+
+    void Noise::GetValues3D(NoiseSettings3D& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step)
+    {
+        GetOctaveNoiseGrid(settings, seed, x, y, z, sizeX, sizeY, sizeZ, step, out);
+    }
+
+    void Noise::GetValues3D(CaveNoiseSettings& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step)
+    {
+        GetOctaveNoiseGrid(settings, seed, x, y, z, sizeX, sizeY, sizeZ, step, out);
+    }
+
+    void Noise::GetValues3D(OreNoiseSettings& settings, int seed, float x, float y, float z, int sizeX, int sizeY, int sizeZ, float* out, float step)
+    {
+        GetOctaveNoiseGrid(settings, seed, x, y, z, sizeX, sizeY, sizeZ, step, out);
+    }
+
+    float Noise::GetUpsampledValue3D(CaveNoiseSettings& settings, int seed, int x, int y, int z)
+    {
+        return GetUpsampledValue(settings, seed, x, y, z);
+    }
+
+    float Noise::GetUpsampledValue3D(OreNoiseSettings& settings, int seed, int x, int y, int z)
+    {
+        return GetUpsampledValue(settings, seed, x, y, z);
+    }
+
+    void Noise::GetUpsampledValues3D(CaveNoiseSettings& settings, int seed, int x, int y, int z, int sizeX, int sizeY, int sizeZ, float* out)
+    {
+        GetUpsampledValues(settings, seed, x, y, z, sizeX, sizeY, sizeZ, out);
+    }
+
+    void Noise::GetUpsampledValues3D(OreNoiseSettings& settings, int seed, int x, int y, int z, int sizeX, int sizeY, int sizeZ, float* out)
+    {
+        GetUpsampledValues(settings, seed, x, y, z, sizeX, sizeY, sizeZ, out);
+    }
+}
@@ -0,0 +1,153 @@
+#include "NoiseKernels.h"
+#include <cstdint>
+
+namespace WillowVox::NoiseKernels
+{
+    // Both tables repeat a 48 value pattern and end with 16 other values
+    static constexpr GradientTable BuildGradientTable(const float (&pattern)[48], const float (&tail)[16])
+    {
+        GradientTable table = {};
+        for (int i = 0; i < 240; i++)
+            table.values[i] = pattern[i % 48];
+        for (int i = 0; i < 16; i++)
+            table.values[240 + i] = tail[i];
+        return table;
+    }
+
+    static constexpr float GRADIENTS_2D_PATTERN[48] = {
+        0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+        0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+        0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+        -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+        -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+        -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    };
+    static constexpr float GRADIENTS_2D_TAIL[16] = {
+        0.38268343236509f, 0.923879532511287f, 0.923879532511287f, 0.38268343236509f, 0.923879532511287f, -0.38268343236509f, 0.38268343236509f, -0.923879532511287f,
+        -0.38268343236509f, -0.923879532511287f, -0.923879532511287f, -0.38268343236509f, -0.923879532511287f, 0.38268343236509f, -0.38268343236509f, 0.923879532511287f,
+    };
+
+    static constexpr float GRADIENTS_3D_PATTERN[48] = {
+        0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+        1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+        1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    };
+    static constexpr float GRADIENTS_3D_TAIL[16] = {
+        1, 1, 0, 0,  0,-1, 1, 0, -1, 1, 0, 0,  0,-1,-1, 0,
+    };
+
+    const GradientTable GRADIENTS_2D = BuildGradientTable(GRADIENTS_2D_PATTERN, GRADIENTS_2D_TAIL);
+    const GradientTable GRADIENTS_3D = BuildGradientTable(GRADIENTS_3D_PATTERN, GRADIENTS_3D_TAIL);
+
+    static constexpr uint32_t PRIME_X = 501125321;
+    static constexpr uint32_t PRIME_Y = 1136930381;
+    static constexpr uint32_t PRIME_Z = 1720413743;
+    static constexpr uint32_t HASH_MULTIPLIER = 0x27d4eb2d;
+
+    // Negative whole numbers floor one too low, as in FastNoiseLite
+    static inline int FastFloor(float f)
+    {
+        return f >= 0 ? (int)f : (int)f - 1;
+    }
+
+    static inline float InterpQuintic(float t)
+    {
+        return t * t * t * (t * (t * 6 - 15) + 10);
+    }
+
+    static inline float Lerp(float a, float b, float t)
+    {
+        return a + t * (b - a);
+    }
+
+    // Integer math is unsigned so the wrapping FastNoiseLite relies on is well defined
+    static inline float GradCoord(int seed, uint32_t xPrimed, uint32_t yPrimed, float xd, float yd)
+    {
+        int32_t hash = (int32_t)(((uint32_t)seed ^ xPrimed ^ yPrimed) * HASH_MULTIPLIER);
+        hash ^= hash >> 15;
+        hash &= 127 << 1;
+        return xd * GRADIENTS_2D.values[hash] + yd * GRADIENTS_2D.values[hash | 1];
+    }
+
+    static inline float GradCoord(int seed, uint32_t xPrimed, uint32_t yPrimed, uint32_t zPrimed, float xd, float yd, float zd)
+    {
+        int32_t hash = (int32_t)(((uint32_t)seed ^ xPrimed ^ yPrimed ^ zPrimed) * HASH_MULTIPLIER);
+        hash ^= hash >> 15;
+        hash &= 63 << 2;
+        return xd * GRADIENTS_3D.values[hash] + yd * GRADIENTS_3D.values[hash | 1] + zd * GRADIENTS_3D.values[hash | 2];
+    }
+
+    static float SinglePerlin(int seed, float x, float y)
+    {
+        int x0 = FastFloor(x);
+        int y0 = FastFloor(y);
+
+        float xd0 = x - (float)x0;
+        float yd0 = y - (float)y0;
+        float xd1 = xd0 - 1;
+        float yd1 = yd0 - 1;
+
+        float xs = InterpQuintic(xd0);
+        float ys = InterpQuintic(yd0);
+
+        uint32_t xPrimed0 = (uint32_t)x0 * PRIME_X;
+        uint32_t yPrimed0 = (uint32_t)y0 * PRIME_Y;
+        uint32_t xPrimed1 = xPrimed0 + PRIME_X;
+        uint32_t yPrimed1 = yPrimed0 + PRIME_Y;
+
+        float xf0 = Lerp(GradCoord(seed, xPrimed0, yPrimed0, xd0, yd0), GradCoord(seed, xPrimed1, yPrimed0, xd1, yd0), xs);
+        float xf1 = Lerp(GradCoord(seed, xPrimed0, yPrimed1, xd0, yd1), GradCoord(seed, xPrimed1, yPrimed1, xd1, yd1), xs);
+
+        return Lerp(xf0, xf1, ys) * 1.4247691104677813f;
+    }
+
+    static float SinglePerlin(int seed, float x, float y, float z)
+    {
+        int x0 = FastFloor(x);
+        int y0 = FastFloor(y);
+        int z0 = FastFloor(z);
+
+        float xd0 = x - (float)x0;
+        float yd0 = y - (float)y0;
+        float zd0 = z - (float)z0;
+        float xd1 = xd0 - 1;
+        float yd1 = yd0 - 1;
+        float zd1 = zd0 - 1;
+
+        float xs = InterpQuintic(xd0);
+        float ys = InterpQuintic(yd0);
+        float zs = InterpQuintic(zd0);
+
+        uint32_t xPrimed0 = (uint32_t)x0 * PRIME_X;
+        uint32_t yPrimed0 = (uint32_t)y0 * PRIME_Y;
+        uint32_t zPrimed0 = (uint32_t)z0 * PRIME_Z;
+        uint32_t xPrimed1 = xPrimed0 + PRIME_X;
+        uint32_t yPrimed1 = yPrimed0 + PRIME_Y;
+        uint32_t zPrimed1 = zPrimed0 + PRIME_Z;
+
+        float xf00 = Lerp(GradCoord(seed, xPrimed0, yPrimed0, zPrimed0, xd0, yd0, zd0), GradCoord(seed, xPrimed1, yPrimed0, zPrimed0, xd1, yd0, zd0), xs);
+        float xf10 = Lerp(GradCoord(seed, xPrimed0, yPrimed1, zPrimed0, xd0, yd1, zd0), GradCoord(seed, xPrimed1, yPrimed1, zPrimed0, xd1, yd1, zd0), xs);
+        float xf01 = Lerp(GradCoord(seed, xPrimed0, yPrimed0, zPrimed1, xd0, yd0, zd1), GradCoord(seed, xPrimed1, yPrimed0, zPrimed1, xd1, yd0, zd1), xs);
+        float xf11 = Lerp(GradCoord(seed, xPrimed0, yPrimed1, zPrimed1, xd0, yd1, zd1), GradCoord(seed, xPrimed1, yPrimed1, zPrimed1, xd1, yd1, zd1), xs);
+
+        float yf0 = Lerp(xf00, xf10, ys);
+        float yf1 = Lerp(xf01, xf11, ys);
+
+        return Lerp(yf0, yf1, zs) * 0.964921414852142333984375f;
+    }
+
+    void PerlinRow2DScalar(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out)
+    {
+        x *= frequency;
+        for (int i = 0; i < count; i++)
+            out[i] += SinglePerlin(seed, x, ys[i] * frequency) * amplitude;
+    }
+
+    void PerlinRow3DScalar(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out)
+    {
+        x *= frequency;
+        y *= frequency;
+        for (int i = 0; i < count; i++)
+            out[i] += SinglePerlin(seed, x, y, zs[i] * frequency) * amplitude;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace WillowVox::NoiseKernels
+{
+    // FastNoiseLite's Perlin gradient tables, indexed the same way
+    struct GradientTable
+    {
+        alignas(32) float values[256];
+    };
+    extern const GradientTable GRADIENTS_2D;
+    extern const GradientTable GRADIENTS_3D;
+
+    /* One octave of FastNoiseLite Perlin noise at the count points (x, ys[i]) or (x, y, zs[i]).
+       Coordinates are scaled by frequency and each sample adds noise * amplitude to out[i].
+       Every kernel repeats FastNoiseLite's float operations in the same order, without fused
+       multiply-adds, so all of them give the same bits as FastNoiseLite::GetNoise. */
+    using PerlinRow2DKernel = void (*)(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out);
+    using PerlinRow3DKernel = void (*)(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out);
+
+    void PerlinRow2DScalar(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out);
+    void PerlinRow3DScalar(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out);
+
+#ifdef WILLOWVOX_NOISE_SIMD
+    // Built with SSE4.1 and AVX2 code generation, only call them when the CPU supports it
+    void PerlinRow2DSSE41(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out);
+    void PerlinRow3DSSE41(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out);
+    void PerlinRow2DAVX2(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out);
+    void PerlinRow3DAVX2(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out);
+#endif
+}
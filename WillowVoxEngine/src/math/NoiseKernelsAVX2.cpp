@@ -0,0 +1,152 @@
+#ifdef WILLOWVOX_NOISE_SIMD
+
+#include "NoiseKernels.h"
+#include <immintrin.h>
+#include <cstdint>
+
+// The scalar kernels in NoiseKernels.cpp, 8 samples at a time
+namespace WillowVox::NoiseKernels
+{
+    static inline __m256i FastFloor(__m256 f)
+    {
+        // Truncates, then takes 1 off every negative value like FastNoiseLite
+        __m256i truncated = _mm256_cvttps_epi32(f);
+        return _mm256_add_epi32(truncated, _mm256_castps_si256(_mm256_cmp_ps(f, _mm256_setzero_ps(), _CMP_LT_OQ)));
+    }
+
+    static inline __m256 InterpQuintic(__m256 t)
+    {
+        __m256 t3 = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+        __m256 inner = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f));
+        return _mm256_mul_ps(t3, _mm256_add_ps(_mm256_mul_ps(t, inner), _mm256_set1_ps(10.0f)));
+    }
+
+    static inline __m256 Lerp(__m256 a, __m256 b, __m256 t)
+    {
+        return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+    }
+
+    static inline __m256 Gather(const float* table, __m256i indices)
+    {
+        return _mm256_i32gather_ps(table, indices, 4);
+    }
+
+    static inline __m256i Hash(__m256i seed, __m256i xPrimed, __m256i yPrimed)
+    {
+        __m256i hash = _mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), yPrimed);
+        return _mm256_mullo_epi32(hash, _mm256_set1_epi32(0x27d4eb2d));
+    }
+
+    static inline __m256i Hash(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256i zPrimed)
+    {
+        __m256i hash = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), yPrimed), zPrimed);
+        return _mm256_mullo_epi32(hash, _mm256_set1_epi32(0x27d4eb2d));
+    }
+
+    static inline __m256 GradCoord(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256 xd, __m256 yd)
+    {
+        __m256i hash = Hash(seed, xPrimed, yPrimed);
+        hash = _mm256_and_si256(_mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15)), _mm256_set1_epi32(127 << 1));
+        __m256 xg = Gather(GRADIENTS_2D.values, hash);
+        __m256 yg = Gather(GRADIENTS_2D.values + 1, hash);
+        return _mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg));
+    }
+
+    static inline __m256 GradCoord(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256i zPrimed, __m256 xd, __m256 yd, __m256 zd)
+    {
+        __m256i hash = Hash(seed, xPrimed, yPrimed, zPrimed);
+        hash = _mm256_and_si256(_mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15)), _mm256_set1_epi32(63 << 2));
+        __m256 xg = Gather(GRADIENTS_3D.values, hash);
+        __m256 yg = Gather(GRADIENTS_3D.values + 1, hash);
+        __m256 zg = Gather(GRADIENTS_3D.values + 2, hash);
+        return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg)), _mm256_mul_ps(zd, zg));
+    }
+
+    static inline __m256 SinglePerlin(__m256i seed, __m256 x, __m256 y)
+    {
+        __m256i x0 = FastFloor(x);
+        __m256i y0 = FastFloor(y);
+
+        __m256 xd0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(x0));
+        __m256 yd0 = _mm256_sub_ps(y, _mm256_cvtepi32_ps(y0));
+        __m256 xd1 = _mm256_sub_ps(xd0, _mm256_set1_ps(1.0f));
+        __m256 yd1 = _mm256_sub_ps(yd0, _mm256_set1_ps(1.0f));
+
+        __m256 xs = InterpQuintic(xd0);
+        __m256 ys = InterpQuintic(yd0);
+
+        x0 = _mm256_mullo_epi32(x0, _mm256_set1_epi32(501125321));
+        y0 = _mm256_mullo_epi32(y0, _mm256_set1_epi32(1136930381));
+        __m256i x1 = _mm256_add_epi32(x0, _mm256_set1_epi32(501125321));
+        __m256i y1 = _mm256_add_epi32(y0, _mm256_set1_epi32(1136930381));
+
+        __m256 xf0 = Lerp(GradCoord(seed, x0, y0, xd0, yd0), GradCoord(seed, x1, y0, xd1, yd0), xs);
+        __m256 xf1 = Lerp(GradCoord(seed, x0, y1, xd0, yd1), GradCoord(seed, x1, y1, xd1, yd1), xs);
+
+        return _mm256_mul_ps(Lerp(xf0, xf1, ys), _mm256_set1_ps(1.4247691104677813f));
+    }
+
+    static inline __m256 SinglePerlin(__m256i seed, __m256 x, __m256 y, __m256 z)
+    {
+        __m256i x0 = FastFloor(x);
+        __m256i y0 = FastFloor(y);
+        __m256i z0 = FastFloor(z);
+
+        __m256 xd0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(x0));
+        __m256 yd0 = _mm256_sub_ps(y, _mm256_cvtepi32_ps(y0));
+        __m256 zd0 = _mm256_sub_ps(z, _mm256_cvtepi32_ps(z0));
+        __m256 xd1 = _mm256_sub_ps(xd0, _mm256_set1_ps(1.0f));
+        __m256 yd1 = _mm256_sub_ps(yd0, _mm256_set1_ps(1.0f));
+        __m256 zd1 = _mm256_sub_ps(zd0, _mm256_set1_ps(1.0f));
+
+        __m256 xs = InterpQuintic(xd0);
+        __m256 ys = InterpQuintic(yd0);
+        __m256 zs = InterpQuintic(zd0);
+
+        x0 = _mm256_mullo_epi32(x0, _mm256_set1_epi32(501125321));
+        y0 = _mm256_mullo_epi32(y0, _mm256_set1_epi32(1136930381));
+        z0 = _mm256_mullo_epi32(z0, _mm256_set1_epi32(1720413743));
+        __m256i x1 = _mm256_add_epi32(x0, _mm256_set1_epi32(501125321));
+        __m256i y1 = _mm256_add_epi32(y0, _mm256_set1_epi32(1136930381));
+        __m256i z1 = _mm256_add_epi32(z0, _mm256_set1_epi32(1720413743));
+
+        __m256 xf00 = Lerp(GradCoord(seed, x0, y0, z0, xd0, yd0, zd0), GradCoord(seed, x1, y0, z0, xd1, yd0, zd0), xs);
+        __m256 xf10 = Lerp(GradCoord(seed, x0, y1, z0, xd0, yd1, zd0), GradCoord(seed, x1, y1, z0, xd1, yd1, zd0), xs);
+        __m256 xf01 = Lerp(GradCoord(seed, x0, y0, z1, xd0, yd0, zd1), GradCoord(seed, x1, y0, z1, xd1, yd0, zd1), xs);
+        __m256 xf11 = Lerp(GradCoord(seed, x0, y1, z1, xd0, yd1, zd1), GradCoord(seed, x1, y1, z1, xd1, yd1, zd1), xs);
+
+        __m256 yf0 = Lerp(xf00, xf10, ys);
+        __m256 yf1 = Lerp(xf01, xf11, ys);
+
+        return _mm256_mul_ps(Lerp(yf0, yf1, zs), _mm256_set1_ps(0.964921414852142333984375f));
+    }
+
+    void PerlinRow2DAVX2(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out)
+    {
+        __m256i seeds = _mm256_set1_epi32(seed);
+        __m256 xScaled = _mm256_set1_ps(x * frequency);
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 noise = SinglePerlin(seeds, xScaled, _mm256_mul_ps(_mm256_loadu_ps(ys + i), _mm256_set1_ps(frequency)));
+            _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(noise, _mm256_set1_ps(amplitude))));
+        }
+        PerlinRow2DScalar(seed, frequency, amplitude, x, ys + i, count - i, out + i);
+    }
+
+    void PerlinRow3DAVX2(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out)
+    {
+        __m256i seeds = _mm256_set1_epi32(seed);
+        __m256 xScaled = _mm256_set1_ps(x * frequency);
+        __m256 yScaled = _mm256_set1_ps(y * frequency);
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 noise = SinglePerlin(seeds, xScaled, yScaled, _mm256_mul_ps(_mm256_loadu_ps(zs + i), _mm256_set1_ps(frequency)));
+            _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(noise, _mm256_set1_ps(amplitude))));
+        }
+        PerlinRow3DScalar(seed, frequency, amplitude, x, y, zs + i, count - i, out + i);
+    }
+}
+
+#endif
@@ -0,0 +1,154 @@
+#ifdef WILLOWVOX_NOISE_SIMD
+
+#include "NoiseKernels.h"
+#include <smmintrin.h>
+#include <cstdint>
+
+// The scalar kernels in NoiseKernels.cpp, 4 samples at a time
+namespace WillowVox::NoiseKernels
+{
+    static inline __m128i FastFloor(__m128 f)
+    {
+        // Truncates, then takes 1 off every negative value like FastNoiseLite
+        __m128i truncated = _mm_cvttps_epi32(f);
+        return _mm_add_epi32(truncated, _mm_castps_si128(_mm_cmplt_ps(f, _mm_setzero_ps())));
+    }
+
+    static inline __m128 InterpQuintic(__m128 t)
+    {
+        __m128 t3 = _mm_mul_ps(_mm_mul_ps(t, t), t);
+        __m128 inner = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+        return _mm_mul_ps(t3, _mm_add_ps(_mm_mul_ps(t, inner), _mm_set1_ps(10.0f)));
+    }
+
+    static inline __m128 Lerp(__m128 a, __m128 b, __m128 t)
+    {
+        return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+    }
+
+    static inline __m128 Gather(const float* table, __m128i indices)
+    {
+        alignas(16) int32_t i[4];
+        _mm_store_si128((__m128i*)i, indices);
+        return _mm_setr_ps(table[i[0]], table[i[1]], table[i[2]], table[i[3]]);
+    }
+
+    static inline __m128i Hash(__m128i seed, __m128i xPrimed, __m128i yPrimed)
+    {
+        __m128i hash = _mm_xor_si128(_mm_xor_si128(seed, xPrimed), yPrimed);
+        return _mm_mullo_epi32(hash, _mm_set1_epi32(0x27d4eb2d));
+    }
+
+    static inline __m128i Hash(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128i zPrimed)
+    {
+        __m128i hash = _mm_xor_si128(_mm_xor_si128(_mm_xor_si128(seed, xPrimed), yPrimed), zPrimed);
+        return _mm_mullo_epi32(hash, _mm_set1_epi32(0x27d4eb2d));
+    }
+
+    static inline __m128 GradCoord(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128 xd, __m128 yd)
+    {
+        __m128i hash = Hash(seed, xPrimed, yPrimed);
+        hash = _mm_and_si128(_mm_xor_si128(hash, _mm_srai_epi32(hash, 15)), _mm_set1_epi32(127 << 1));
+        __m128 xg = Gather(GRADIENTS_2D.values, hash);
+        __m128 yg = Gather(GRADIENTS_2D.values + 1, hash);
+        return _mm_add_ps(_mm_mul_ps(xd, xg), _mm_mul_ps(yd, yg));
+    }
+
+    static inline __m128 GradCoord(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128i zPrimed, __m128 xd, __m128 yd, __m128 zd)
+    {
+        __m128i hash = Hash(seed, xPrimed, yPrimed, zPrimed);
+        hash = _mm_and_si128(_mm_xor_si128(hash, _mm_srai_epi32(hash, 15)), _mm_set1_epi32(63 << 2));
+        __m128 xg = Gather(GRADIENTS_3D.values, hash);
+        __m128 yg = Gather(GRADIENTS_3D.values + 1, hash);
+        __m128 zg = Gather(GRADIENTS_3D.values + 2, hash);
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(xd, xg), _mm_mul_ps(yd, yg)), _mm_mul_ps(zd, zg));
+    }
+
+    static inline __m128 SinglePerlin(__m128i seed, __m128 x, __m128 y)
+    {
+        __m128i x0 = FastFloor(x);
+        __m128i y0 = FastFloor(y);
+
+        __m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+        __m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+        __m128 xd1 = _mm_sub_ps(xd0, _mm_set1_ps(1.0f));
+        __m128 yd1 = _mm_sub_ps(yd0, _mm_set1_ps(1.0f));
+
+        __m128 xs = InterpQuintic(xd0);
+        __m128 ys = InterpQuintic(yd0);
+
+        x0 = _mm_mullo_epi32(x0, _mm_set1_epi32(501125321));
+        y0 = _mm_mullo_epi32(y0, _mm_set1_epi32(1136930381));
+        __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(501125321));
+        __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(1136930381));
+
+        __m128 xf0 = Lerp(GradCoord(seed, x0, y0, xd0, yd0), GradCoord(seed, x1, y0, xd1, yd0), xs);
+        __m128 xf1 = Lerp(GradCoord(seed, x0, y1, xd0, yd1), GradCoord(seed, x1, y1, xd1, yd1), xs);
+
+        return _mm_mul_ps(Lerp(xf0, xf1, ys), _mm_set1_ps(1.4247691104677813f));
+    }
+
+    static inline __m128 SinglePerlin(__m128i seed, __m128 x, __m128 y, __m128 z)
+    {
+        __m128i x0 = FastFloor(x);
+        __m128i y0 = FastFloor(y);
+        __m128i z0 = FastFloor(z);
+
+        __m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+        __m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+        __m128 zd0 = _mm_sub_ps(z, _mm_cvtepi32_ps(z0));
+        __m128 xd1 = _mm_sub_ps(xd0, _mm_set1_ps(1.0f));
+        __m128 yd1 = _mm_sub_ps(yd0, _mm_set1_ps(1.0f));
+        __m128 zd1 = _mm_sub_ps(zd0, _mm_set1_ps(1.0f));
+
+        __m128 xs = InterpQuintic(xd0);
+        __m128 ys = InterpQuintic(yd0);
+        __m128 zs = InterpQuintic(zd0);
+
+        x0 = _mm_mullo_epi32(x0, _mm_set1_epi32(501125321));
+        y0 = _mm_mullo_epi32(y0, _mm_set1_epi32(1136930381));
+        z0 = _mm_mullo_epi32(z0, _mm_set1_epi32(1720413743));
+        __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(501125321));
+        __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(1136930381));
+        __m128i z1 = _mm_add_epi32(z0, _mm_set1_epi32(1720413743));
+
+        __m128 xf00 = Lerp(GradCoord(seed, x0, y0, z0, xd0, yd0, zd0), GradCoord(seed, x1, y0, z0, xd1, yd0, zd0), xs);
+        __m128 xf10 = Lerp(GradCoord(seed, x0, y1, z0, xd0, yd1, zd0), GradCoord(seed, x1, y1, z0, xd1, yd1, zd0), xs);
+        __m128 xf01 = Lerp(GradCoord(seed, x0, y0, z1, xd0, yd0, zd1), GradCoord(seed, x1, y0, z1, xd1, yd0, zd1), xs);
+        __m128 xf11 = Lerp(GradCoord(seed, x0, y1, z1, xd0, yd1, zd1), GradCoord(seed, x1, y1, z1, xd1, yd1, zd1), xs);
+
+        __m128 yf0 = Lerp(xf00, xf10, ys);
+        __m128 yf1 = Lerp(xf01, xf11, ys);
+
+        return _mm_mul_ps(Lerp(yf0, yf1, zs), _mm_set1_ps(0.964921414852142333984375f));
+    }
+
+    void PerlinRow2DSSE41(int seed, float frequency, float amplitude, float x, const float* ys, int count, float* out)
+    {
+        __m128i seeds = _mm_set1_epi32(seed);
+        __m128 xScaled = _mm_set1_ps(x * frequency);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 noise = SinglePerlin(seeds, xScaled, _mm_mul_ps(_mm_loadu_ps(ys + i), _mm_set1_ps(frequency)));
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(noise, _mm_set1_ps(amplitude))));
+        }
+        PerlinRow2DScalar(seed, frequency, amplitude, x, ys + i, count - i, out + i);
+    }
+
+    void PerlinRow3DSSE41(int seed, float frequency, float amplitude, float x, float y, const float* zs, int count, float* out)
+    {
+        __m128i seeds = _mm_set1_epi32(seed);
+        __m128 xScaled = _mm_set1_ps(x * frequency);
+        __m128 yScaled = _mm_set1_ps(y * frequency);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 noise = SinglePerlin(seeds, xScaled, yScaled, _mm_mul_ps(_mm_loadu_ps(zs + i), _mm_set1_ps(frequency)));
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(noise, _mm_set1_ps(amplitude))));
+        }
+        PerlinRow3DScalar(seed, frequency, amplitude, x, y, zs + i, count - i, out + i);
+    }
+}
+
+#endif
@@ -0,0 +1,27 @@
+#include <WillowVox/rendering/BaseMaterial.h>
+
+namespace WillowVox
+{
+	BaseMaterial::BaseMaterial(Shader* shader)
+		: _shader(shader)
+	{
+	}
+
+	void BaseMaterial::Bind()
+	{
+		_shader->Bind();
+		SetShaderProperties();
+	}
+
+	void BaseMaterial::SetCameraShaderProperties(const glm::mat4& view, const glm::mat4& projection)
+	{
+		_shader->SetMat4("view", view);
+		_shader->SetMat4("projection", projection);
+	}
+
+	void BaseMaterial::SetModelShaderProperties(const glm::vec3& model)
+	{
+		// Chunk shaders take the model position as a vec3 offset
+		_shader->SetVec3("model", model);
+	}
+}
@@ -0,0 +1,51 @@
+#include <WillowVox/rendering/Camera.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace WillowVox
+{
+    static const glm::vec3 WORLD_UP = glm::vec3(0.0f, 1.0f, 0.0f);
+
+    Camera::Camera(Window* window, glm::vec3 position, glm::vec3 direction)
+        : position(position), direction(direction), _window(window)
+    {
+    }
+
+    Camera::Camera(Window* window, float posX, float posY, float posZ, float roll, float pitch, float yaw)
+        : position(posX, posY, posZ), direction(pitch, yaw, roll), _window(window)
+    {
+    }
+
+    glm::vec3 Camera::Front()
+    {
+        float pitch = glm::radians(direction.x);
+        float yaw = glm::radians(direction.y);
+        return glm::normalize(glm::vec3(glm::cos(yaw) * glm::cos(pitch), glm::sin(pitch), glm::sin(yaw) * glm::cos(pitch)));
+    }
+
+    glm::vec3 Camera::Right()
+    {
+        // Roll turns right and up around the front
+        glm::vec3 front = Front();
+        glm::vec3 right = glm::normalize(glm::cross(front, WORLD_UP));
+        glm::vec3 up = glm::cross(right, front);
+        float roll = glm::radians(direction.z);
+        return glm::normalize(right * glm::cos(roll) + up * glm::sin(roll));
+    }
+
+    glm::vec3 Camera::Up()
+    {
+        return glm::normalize(glm::cross(Right(), Front()));
+    }
+
+    glm::mat4 Camera::GetViewMatrix()
+    {
+        return glm::lookAt(position, position + Front(), Up());
+    }
+
+    glm::mat4 Camera::GetProjectionMatrix()
+    {
+        glm::ivec2 size = _window->GetWindowSize();
+        float aspect = size.y > 0 ? (float)size.x / size.y : 1.0f;
+        return glm::perspective(glm::radians(fov), aspect, 0.1f, 1000.0f);
+    }
+}
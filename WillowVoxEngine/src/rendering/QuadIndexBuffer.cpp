@@ -0,0 +1,21 @@
+#include <WillowVox/rendering/QuadIndexBuffer.h>
+
+namespace WillowVox
+{
+    const std::vector<uint32_t>& QuadIndexBuffer::GetIndices()
+    {
+        static const std::vector<uint32_t> indices = [] {
+            static const uint32_t QUAD_INDICES[INDICES_PER_QUAD] = { 0, 1, 2, 2, 1, 3 };
+
+            std::vector<uint32_t> result;
+            result.reserve((std::size_t)MAX_QUADS * INDICES_PER_QUAD);
+            for (uint32_t quad = 0; quad < MAX_QUADS; quad++)
+            {
+                for (uint32_t index : QUAD_INDICES)
+                    result.push_back(quad * 4 + index);
+            }
+            return result;
+        }();
+        return indices;
+    }
+}
@@ -0,0 +1,21 @@
+#include <WillowVox/rendering/RenderingAPI.h>
+#ifdef WILLOWVOX_RENDERING_OPENGL
+#include <WillowVox/rendering/opengl/OpenGLAPI.h>
+#else
+#include <WillowVox/rendering/null/NullAPI.h>
+#endif
+
+namespace WillowVox
+{
+	RenderingAPI* RenderingAPI::m_renderingAPI = nullptr;
+
+	RenderingAPI* RenderingAPI::GetRenderingAPI()
+	{
+#ifdef WILLOWVOX_RENDERING_OPENGL
+		return new OpenGLAPI();
+#else
+		// Builds without a GPU backend run headless
+		return new NullAPI();
+#endif
+	}
+}
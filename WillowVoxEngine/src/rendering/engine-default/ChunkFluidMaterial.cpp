@@ -0,0 +1,33 @@
+#include <WillowVox/rendering/engine-default/ChunkFluidMaterial.h>
+#include <WillowVox/rendering/engine-default/FluidVertex.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <cstddef>
+
+namespace WillowVox
+{
+	// Size of one block texture in the atlas, in pixels
+	static constexpr int ATLAS_TILE_SIZE = 16;
+
+	ChunkFluidMaterial::ChunkFluidMaterial(Shader* shader, Texture* texture)
+		: BaseMaterial(shader)
+	{
+		_texture = texture;
+	}
+
+	void ChunkFluidMaterial::SetVertexAttributes()
+	{
+		RenderingAPI::m_renderingAPI->SetVertexAttrib3b(0, sizeof(FluidVertex), offsetof(FluidVertex, m_x));
+		RenderingAPI::m_renderingAPI->SetVertexAttrib2f(1, sizeof(FluidVertex), offsetof(FluidVertex, m_texPos));
+		RenderingAPI::m_renderingAPI->SetVertexAttrib1b(2, sizeof(FluidVertex), offsetof(FluidVertex, m_direction));
+		RenderingAPI::m_renderingAPI->SetVertexAttrib1b(3, sizeof(FluidVertex), offsetof(FluidVertex, m_top));
+	}
+
+	void ChunkFluidMaterial::SetShaderProperties()
+	{
+		// The surface animation is driven by time
+		_texture->BindTexture(Texture::TEX00);
+		_shader->SetFloat("texMultiplier", (float)ATLAS_TILE_SIZE / _texture->m_width);
+		_shader->SetFloat("time", (float)RenderingAPI::m_renderingAPI->GetTime());
+		RenderingAPI::m_renderingAPI->SetBlending(true);
+	}
+}
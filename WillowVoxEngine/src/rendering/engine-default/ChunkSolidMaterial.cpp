@@ -0,0 +1,29 @@
+#include <WillowVox/rendering/engine-default/ChunkSolidMaterial.h>
+#include <WillowVox/rendering/engine-default/ChunkVertex.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <cstddef>
+
+namespace WillowVox
+{
+	// Size of one block texture in the atlas, in pixels
+	static constexpr int ATLAS_TILE_SIZE = 16;
+
+	ChunkSolidMaterial::ChunkSolidMaterial(Shader* shader, Texture* texture)
+		: BaseMaterial(shader)
+	{
+		_texture = texture;
+	}
+
+	void ChunkSolidMaterial::SetVertexAttributes()
+	{
+		// Unpacked by chunk_solid_vert.glsl
+		RenderingAPI::m_renderingAPI->SetVertexAttrib1ui(0, sizeof(ChunkVertex), offsetof(ChunkVertex, m_data));
+	}
+
+	void ChunkSolidMaterial::SetShaderProperties()
+	{
+		_texture->BindTexture(Texture::TEX00);
+		_shader->SetFloat("texMultiplier", (float)ATLAS_TILE_SIZE / _texture->m_width);
+		RenderingAPI::m_renderingAPI->SetBlending(false);
+	}
+}
@@ -0,0 +1,30 @@
+#include <WillowVox/rendering/engine-default/TextureMaterial.h>
+#include <WillowVox/rendering/engine-default/Vertex.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <cstddef>
+
+namespace WillowVox
+{
+	// Size of one block texture in the atlas, in pixels
+	static constexpr int ATLAS_TILE_SIZE = 16;
+
+	TextureMaterial::TextureMaterial(Shader* shader, Texture* texture)
+		: BaseMaterial(shader)
+	{
+		_texture = texture;
+	}
+
+	void TextureMaterial::SetVertexAttributes()
+	{
+		RenderingAPI::m_renderingAPI->SetVertexAttrib3f(0, sizeof(Vertex), offsetof(Vertex, m_position));
+		RenderingAPI::m_renderingAPI->SetVertexAttrib2f(1, sizeof(Vertex), offsetof(Vertex, m_texPos));
+	}
+
+	void TextureMaterial::SetShaderProperties()
+	{
+		// Texture coordinates are in atlas tiles, like the chunk materials'
+		_texture->BindTexture(Texture::TEX00);
+		_shader->SetFloat("texMultiplier", (float)ATLAS_TILE_SIZE / _texture->m_width);
+		RenderingAPI::m_renderingAPI->SetBlending(false);
+	}
+}
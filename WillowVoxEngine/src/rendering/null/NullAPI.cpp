@@ -0,0 +1,214 @@
+#include <WillowVox/rendering/null/NullAPI.h>
+#include <WillowVox/rendering/null/NullMesh.h>
+#include <WillowVox/rendering/null/NullShader.h>
+#include <WillowVox/rendering/null/NullTexture.h>
+#include <WillowVox/rendering/null/NullWindow.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+namespace WillowVox
+{
+	Window* NullAPI::CreateWindow(int width, int height, const char*)
+	{
+		NullWindow* window = new NullWindow(*this, width, height);
+
+		// Headless runs have nobody to close the window
+		const char* maxFrames = std::getenv("WILLOWVOX_NULL_FRAMES");
+		window->m_maxFrames = maxFrames != nullptr ? std::max(std::atoi(maxFrames), 0) : 600;
+		return window;
+	}
+
+	Shader* NullAPI::CreateShader(const char* vertexShaderPath, const char* fragmentShaderPath)
+	{
+		NullShader* shader = new NullShader(*this, vertexShaderPath);
+
+		RenderCommand command = { RenderCommand::CREATE_SHADER, shader };
+		command.name = std::string(vertexShaderPath) + " " + fragmentShaderPath;
+		Record(command);
+		return shader;
+	}
+
+	Shader* NullAPI::CreateShaderFromString(const char*, const char*)
+	{
+		NullShader* shader = new NullShader(*this, "<string>");
+		Record({ RenderCommand::CREATE_SHADER, shader, shader->m_name });
+		return shader;
+	}
+
+	Mesh* NullAPI::CreateMesh()
+	{
+		NullMesh* mesh = new NullMesh(*this);
+		Record({ RenderCommand::CREATE_MESH, mesh });
+		return mesh;
+	}
+
+	Texture* NullAPI::CreateTexture(const char* path)
+	{
+		NullTexture* texture = new NullTexture(*this);
+		Record({ RenderCommand::CREATE_TEXTURE, texture, path });
+		return texture;
+	}
+
+	void NullAPI::SetVertexAttrib1f(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("1f", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib2f(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("2f", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib3f(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("3f", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib1b(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("1b", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib2b(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("2b", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib3b(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("3b", id, size, offset);
+	}
+
+	void NullAPI::SetVertexAttrib1ui(int id, uint32_t size, std::size_t offset)
+	{
+		RecordVertexAttrib("1ui", id, size, offset);
+	}
+
+	double NullAPI::GetTime()
+	{
+		static const auto start = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void NullAPI::SetCullFace(bool enabled)
+	{
+		RecordState("cullFace", enabled);
+	}
+
+	void NullAPI::SetDepthTest(bool enabled)
+	{
+		RecordState("depthTest", enabled);
+	}
+
+	void NullAPI::SetBlending(bool enabled)
+	{
+		RecordState("blending", enabled);
+	}
+
+	void NullAPI::SetInvertRenderMode(bool enabled)
+	{
+		RecordState("invertRenderMode", enabled);
+	}
+
+	void NullAPI::SetRenderingMode(RenderMode mode)
+	{
+		RecordState("renderingMode", (float)mode);
+	}
+
+	void NullAPI::SetLineWidth(float width)
+	{
+		RecordState("lineWidth", width);
+	}
+
+	void NullAPI::SetVsync(bool enabled)
+	{
+		m_vsync = enabled;
+		RecordState("vsync", enabled);
+	}
+
+	void NullAPI::RenderTriangles(glm::vec3*, int vertexCount, glm::vec4 color)
+	{
+		m_drawCalls++;
+		m_drawnVertices += vertexCount;
+
+		RenderCommand command = { RenderCommand::DRAW_TRIANGLES };
+		command.count = vertexCount;
+		command.size = sizeof(glm::vec3);
+		command.values[0] = color.r;
+		command.values[1] = color.g;
+		command.values[2] = color.b;
+		command.values[3] = color.a;
+		command.valueCount = 4;
+		Record(command);
+	}
+
+	void NullAPI::Record(const RenderCommand& command)
+	{
+		if (m_recording)
+			m_commands.push_back(command);
+	}
+
+	std::size_t NullAPI::CountCommands(RenderCommand::Type type) const
+	{
+		return std::count_if(m_commands.begin(), m_commands.end(), [type](const RenderCommand& command) { return command.type == type; });
+	}
+
+	const char* NullAPI::GetCommandName(RenderCommand::Type type)
+	{
+		switch (type)
+		{
+		case RenderCommand::FRAME_START: return "FrameStart";
+		case RenderCommand::FRAME_END: return "FrameEnd";
+		case RenderCommand::CREATE_MESH: return "CreateMesh";
+		case RenderCommand::DELETE_MESH: return "DeleteMesh";
+		case RenderCommand::UPLOAD_MESH: return "UploadMesh";
+		case RenderCommand::DRAW_MESH: return "DrawMesh";
+		case RenderCommand::CREATE_SHADER: return "CreateShader";
+		case RenderCommand::BIND_SHADER: return "BindShader";
+		case RenderCommand::SET_UNIFORM: return "SetUniform";
+		case RenderCommand::CREATE_TEXTURE: return "CreateTexture";
+		case RenderCommand::BIND_TEXTURE: return "BindTexture";
+		case RenderCommand::SET_VERTEX_ATTRIB: return "SetVertexAttrib";
+		case RenderCommand::SET_STATE: return "SetState";
+		case RenderCommand::DRAW_TRIANGLES: return "DrawTriangles";
+		case RenderCommand::DRAW_UI: return "DrawUI";
+		}
+		return "Unknown";
+	}
+
+	void NullAPI::WriteCommands(FILE* file) const
+	{
+		for (const RenderCommand& command : m_commands)
+		{
+			fprintf(file, "%s %p", GetCommandName(command.type), command.object);
+			if (!command.name.empty())
+				fprintf(file, " %s", command.name.c_str());
+			if (command.count != 0 || command.size != 0)
+				fprintf(file, " count=%d size=%u", command.count, command.size);
+			for (int i = 0; i < command.valueCount; i++)
+				fprintf(file, i == 0 ? " [%g" : " %g", command.values[i]);
+			fprintf(file, command.valueCount > 0 ? "]\n" : "\n");
+		}
+	}
+
+	void NullAPI::RecordState(const char* name, float value)
+	{
+		RenderCommand command = { RenderCommand::SET_STATE, nullptr, name };
+		command.values[0] = value;
+		command.valueCount = 1;
+		Record(command);
+	}
+
+	void NullAPI::RecordVertexAttrib(const char* type, int id, uint32_t size, std::size_t offset)
+	{
+		// The attribute's offset goes in the first value
+		RenderCommand command = { RenderCommand::SET_VERTEX_ATTRIB, nullptr, type };
+		command.count = id;
+		command.size = size;
+		command.values[0] = (float)offset;
+		command.valueCount = 1;
+		Record(command);
+	}
+}
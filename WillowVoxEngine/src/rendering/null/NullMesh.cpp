@@ -0,0 +1,88 @@
+#include <WillowVox/rendering/null/NullMesh.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+
+namespace WillowVox
+{
+	NullMesh::NullMesh(NullAPI& api)
+		: _api(api)
+	{
+	}
+
+	NullMesh::~NullMesh()
+	{
+		_api.Record({ RenderCommand::DELETE_MESH, this });
+	}
+
+	void NullMesh::Render(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode)
+	{
+		material.Bind();
+		material.SetModelShaderProperties(position);
+		Draw(mode);
+	}
+
+	void NullMesh::Render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode)
+	{
+		material.Bind();
+		material.SetCameraShaderProperties(view, projection);
+		material.SetModelShaderProperties(position);
+		Draw(mode);
+	}
+
+	void NullMesh::RenderAsInstance(const glm::vec3& position, BaseMaterial& material, const PolygonMode& mode)
+	{
+		material.SetModelShaderProperties(position);
+		Draw(mode);
+	}
+
+	void NullMesh::SetMesh(BaseVertex*, uint32_t vertexTypeSize, int numVertices, uint32_t*, int numIndices)
+	{
+		m_vertexCount = numVertices;
+		m_indexCount = numIndices;
+		m_vertexSize = vertexTypeSize;
+
+		_api.m_meshUploads++;
+		_api.m_uploadedVertices += numVertices;
+		_api.m_uploadedBytes += (uint64_t)numVertices * vertexTypeSize + (uint64_t)numIndices * sizeof(uint32_t);
+
+		RenderCommand command = { RenderCommand::UPLOAD_MESH, this };
+		command.count = numVertices;
+		command.size = vertexTypeSize;
+		_api.Record(command);
+	}
+
+	void NullMesh::SetMesh(BaseVertex*, uint32_t vertexTypeSize, int numQuads)
+	{
+		// Quad meshes share the QuadIndexBuffer, so no indices are uploaded
+		m_vertexCount = numQuads * 4;
+		m_indexCount = numQuads * 6;
+		m_vertexSize = vertexTypeSize;
+
+		_api.m_meshUploads++;
+		_api.m_uploadedVertices += (uint64_t)numQuads * 4;
+		_api.m_uploadedBytes += (uint64_t)numQuads * 4 * vertexTypeSize;
+
+		RenderCommand command = { RenderCommand::UPLOAD_MESH, this };
+		command.count = numQuads * 4;
+		command.size = vertexTypeSize;
+		_api.Record(command);
+	}
+
+	void NullMesh::SetVertexProperties(BaseMaterial& material)
+	{
+		material.SetVertexAttributes();
+	}
+
+	void NullMesh::Draw(const PolygonMode& mode)
+	{
+		_api.m_drawCalls++;
+		_api.m_drawnVertices += m_vertexCount;
+
+		// The polygon mode goes in the first value
+		RenderCommand command = { RenderCommand::DRAW_MESH, this };
+		command.count = m_vertexCount;
+		command.size = m_vertexSize;
+		command.values[0] = (float)mode;
+		command.valueCount = 1;
+		_api.Record(command);
+	}
+}
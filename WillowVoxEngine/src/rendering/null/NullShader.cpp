@@ -0,0 +1,80 @@
+#include <WillowVox/rendering/null/NullShader.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace WillowVox
+{
+	NullShader::NullShader(NullAPI& api, const char* name)
+		: m_name(name), _api(api)
+	{
+	}
+
+	void NullShader::Bind()
+	{
+		_api.Record({ RenderCommand::BIND_SHADER, this, m_name });
+	}
+
+	void NullShader::SetBool(const char* name, bool value) const
+	{
+		float values[] = { (float)value };
+		SetUniform(name, values, 1);
+	}
+
+	void NullShader::SetInt(const char* name, int value) const
+	{
+		float values[] = { (float)value };
+		SetUniform(name, values, 1);
+	}
+
+	void NullShader::SetFloat(const char* name, float value) const
+	{
+		SetUniform(name, &value, 1);
+	}
+
+	void NullShader::SetVec2(const char* name, glm::vec2 value) const
+	{
+		SetUniform(name, glm::value_ptr(value), 2);
+	}
+
+	void NullShader::SetVec2(const char* name, float x, float y) const
+	{
+		SetVec2(name, glm::vec2(x, y));
+	}
+
+	void NullShader::SetVec3(const char* name, glm::vec3 value) const
+	{
+		SetUniform(name, glm::value_ptr(value), 3);
+	}
+
+	void NullShader::SetVec3(const char* name, float x, float y, float z) const
+	{
+		SetVec3(name, glm::vec3(x, y, z));
+	}
+
+	void NullShader::SetVec4(const char* name, glm::vec4 value) const
+	{
+		SetUniform(name, glm::value_ptr(value), 4);
+	}
+
+	void NullShader::SetVec4(const char* name, float x, float y, float z, float w) const
+	{
+		SetVec4(name, glm::vec4(x, y, z, w));
+	}
+
+	void NullShader::SetMat4(const char* name, glm::mat4 value) const
+	{
+		SetUniform(name, glm::value_ptr(value), 16);
+	}
+
+	void NullShader::SetUniform(const char* name, const float* values, int count) const
+	{
+		if (!_api.m_recording)
+			return;
+
+		RenderCommand command = { RenderCommand::SET_UNIFORM, this, name };
+		for (int i = 0; i < count; i++)
+			command.values[i] = values[i];
+		command.valueCount = count;
+		_api.Record(command);
+	}
+}
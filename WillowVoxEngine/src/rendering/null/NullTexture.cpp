@@ -0,0 +1,19 @@
+#include <WillowVox/rendering/null/NullTexture.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+
+namespace WillowVox
+{
+    NullTexture::NullTexture(NullAPI& api)
+        : _api(api)
+    {
+        m_width = 256;
+        m_height = 256;
+    }
+
+    void NullTexture::BindTexture(TexSlot slot)
+    {
+        RenderCommand command = { RenderCommand::BIND_TEXTURE, this };
+        command.count = slot;
+        _api.Record(command);
+    }
+}
@@ -0,0 +1,192 @@
+#include <WillowVox/rendering/null/NullWindow.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+#include <WillowVox/core/Logger.h>
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace WillowVox
+{
+	NullWindow::NullWindow(NullAPI& api, int width, int height)
+		: _api(api), _size(width, height)
+	{
+		_lastFrameEnd = std::chrono::steady_clock::now();
+
+		// ImGui runs without a platform or renderer backend, so the font atlas is only built on the CPU
+		IMGUI_CHECKVERSION();
+		_imguiContext = ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.IniFilename = nullptr;
+		io.DisplaySize = ImVec2((float)width, (float)height);
+		unsigned char* pixels;
+		int fontWidth, fontHeight;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &fontWidth, &fontHeight);
+	}
+
+	NullWindow::~NullWindow()
+	{
+		Logger::EngineLog("Null window closed after %d frames: %llu draw calls (%llu vertices), %llu mesh uploads (%.1f MB)",
+			m_frame, (unsigned long long)_api.m_drawCalls, (unsigned long long)_api.m_drawnVertices,
+			(unsigned long long)_api.m_meshUploads, _api.m_uploadedBytes / 1048576.0);
+
+		// The log holds the last frame when it's cleared every frame
+		if (const char* logPath = std::getenv("WILLOWVOX_NULL_LOG"))
+		{
+			if (FILE* file = fopen(logPath, "w"))
+			{
+				_api.WriteCommands(file);
+				fclose(file);
+			}
+		}
+
+		ImGui::DestroyContext(_imguiContext);
+	}
+
+	void NullWindow::FrameStart()
+	{
+		if (_api.m_clearEachFrame)
+			_api.ClearCommands();
+
+		RenderCommand command = { RenderCommand::FRAME_START, this };
+		command.count = m_frame;
+		_api.Record(command);
+	}
+
+	void NullWindow::PostProcessingStart()
+	{
+	}
+
+	void NullWindow::PostProcessingEnd()
+	{
+		// Each enabled shader would be a full screen pass
+		for (PostProcessingShader* shader : _postProcessingShaders)
+		{
+			if (shader->enabled)
+				shader->shader->Bind();
+		}
+	}
+
+	void NullWindow::UIStart()
+	{
+		ImGui::SetCurrentContext(_imguiContext);
+		ImGuiIO& io = ImGui::GetIO();
+		io.DeltaTime = 1.0f / 60.0f;
+		io.MousePos = _mouseDisabled ? ImVec2(-FLT_MAX, -FLT_MAX) : ImVec2(_mousePos.x, _mousePos.y);
+		ImGui::NewFrame();
+	}
+
+	void NullWindow::UIEnd()
+	{
+		ImGui::Render();
+
+		// The vertex count of the whole UI goes in count
+		RenderCommand command = { RenderCommand::DRAW_UI, this };
+		command.count = ImGui::GetDrawData()->TotalVtxCount;
+		command.size = sizeof(ImDrawVert);
+		_api.Record(command);
+	}
+
+	void NullWindow::FrameEnd()
+	{
+		RenderCommand command = { RenderCommand::FRAME_END, this };
+		command.count = m_frame;
+		_api.Record(command);
+
+		m_frame++;
+		if (m_maxFrames > 0 && m_frame >= m_maxFrames)
+			_shouldClose = true;
+
+		if (_api.m_vsync)
+		{
+			auto frameEnd = _lastFrameEnd + std::chrono::microseconds(1000000 / 60);
+			std::this_thread::sleep_until(frameEnd);
+			_lastFrameEnd = std::max(frameEnd, std::chrono::steady_clock::now());
+		}
+		else
+			_lastFrameEnd = std::chrono::steady_clock::now();
+	}
+
+	void NullWindow::CloseWindow()
+	{
+		_shouldClose = true;
+	}
+
+	void NullWindow::SetBackgroundColor(glm::vec4 color)
+	{
+		RenderCommand command = { RenderCommand::SET_STATE, this, "backgroundColor" };
+		command.values[0] = color.r;
+		command.values[1] = color.g;
+		command.values[2] = color.b;
+		command.values[3] = color.a;
+		command.valueCount = 4;
+		_api.Record(command);
+	}
+
+	void NullWindow::SetBackgroundColor(float r, float g, float b, float a)
+	{
+		SetBackgroundColor(glm::vec4(r, g, b, a));
+	}
+
+	void NullWindow::SetMouseDisabled(bool state)
+	{
+		_mouseDisabled = state;
+	}
+
+	void NullWindow::ToggleMouseDisabled()
+	{
+		_mouseDisabled = !_mouseDisabled;
+	}
+
+	void NullWindow::SetKeyDown(Key key, bool down)
+	{
+		if (down && _keysDown.insert(key).second)
+		{
+			KeyPressEvent event(key);
+			KeyPressEventDispatcher.Dispatch(event);
+		}
+		else if (!down && _keysDown.erase(key) > 0)
+		{
+			KeyReleaseEvent event(key);
+			KeyReleaseEventDispatcher.Dispatch(event);
+		}
+	}
+
+	void NullWindow::SetMousePos(glm::vec2 pos)
+	{
+		MouseMoveEvent event(pos.x - _mousePos.x, pos.y - _mousePos.y);
+		_mousePos = pos;
+		MouseMoveEventDispatcher.Dispatch(event);
+	}
+
+	bool NullWindow::ShouldClose()
+	{
+		return _shouldClose;
+	}
+
+	glm::ivec2 NullWindow::GetWindowSize()
+	{
+		return _size;
+	}
+
+	bool NullWindow::KeyDown(Key key)
+	{
+		return _keysDown.count(key) > 0;
+	}
+
+	bool NullWindow::MouseButtonDown(int)
+	{
+		return false;
+	}
+
+	glm::vec2 NullWindow::GetMousePos()
+	{
+		return _mousePos;
+	}
+
+	bool NullWindow::MouseDisabled()
+	{
+		return _mouseDisabled;
+	}
+}
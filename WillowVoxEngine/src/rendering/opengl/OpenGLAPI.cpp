@@ -0,0 +1,13 @@
+#include <WillowVox/rendering/opengl/OpenGLAPI.h>
+
+// The rest of the OpenGL backend is not in this tree, only the parts the chunk renderer added are
+
+namespace WillowVox
+{
+	// Integer attributes go through glVertexAttribIPointer so the shader gets the bits, not a converted float
+	void OpenGLAPI::SetVertexAttrib1ui(int id, uint32_t size, std::size_t offset)
+	{
+		glVertexAttribIPointer(id, 1, GL_UNSIGNED_INT, size, (void*)offset);
+		glEnableVertexAttribArray(id);
+	}
+}
@@ -0,0 +1,33 @@
+#include <WillowVox/rendering/opengl/OpenGLMesh.h>
+#include <WillowVox/rendering/QuadIndexBuffer.h>
+#include <glad/glad.h>
+
+// The rest of the OpenGL backend is not in this tree, only the parts the chunk renderer added are
+
+namespace WillowVox
+{
+	// One element buffer holding QuadIndexBuffer, uploaded on first use and bound by every quad mesh
+	static unsigned int GetQuadElementBuffer()
+	{
+		static unsigned int buffer = 0;
+		if (buffer == 0)
+		{
+			const std::vector<uint32_t>& indices = QuadIndexBuffer::GetIndices();
+			glGenBuffers(1, &buffer);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+		}
+		return buffer;
+	}
+
+	void OpenGLMesh::SetMesh(BaseVertex* vertices, uint32_t vertexTypeSize, int numQuads)
+	{
+		glBindVertexArray(_vao);
+		glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)numQuads * 4 * vertexTypeSize, vertices, GL_STATIC_DRAW);
+
+		// The element buffer binding is part of the VAO, so it's bound while the VAO is
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, GetQuadElementBuffer());
+		_numTriangles = numQuads * QuadIndexBuffer::INDICES_PER_QUAD;
+	}
+}
@@ -0,0 +1,35 @@
+#include <WillowVox/resources/Blocks.h>
+#include <cstring>
+
+namespace WillowVox
+{
+    // Id 0 is always air, registered blocks start at 1
+    std::vector<Block> Blocks::blocks = { Block(0, 0, Block::TRANSPARENT, "Air") };
+    std::unordered_map<const char*, uint16_t> Blocks::blockNames = { { "Air", 0 } };
+
+    void Blocks::RegisterBlock(Block block)
+    {
+        blockNames[block.blockName] = (uint16_t)blocks.size();
+        blocks.push_back(block);
+    }
+
+    Block& Blocks::GetBlock(const char* name)
+    {
+        auto it = blockNames.find(name);
+        if (it != blockNames.end())
+            return blocks[it->second];
+
+        // The map is keyed by pointer, fall back to comparing the names
+        for (Block& block : blocks)
+        {
+            if (std::strcmp(block.blockName, name) == 0)
+                return block;
+        }
+        return blocks[0];
+    }
+
+    Block& Blocks::GetBlock(uint16_t id)
+    {
+        return blocks[id];
+    }
+}
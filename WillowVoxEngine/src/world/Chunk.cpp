@@ -0,0 +1,611 @@
+#include <WillowVox/world/Chunk.h>
+#include <WillowVox/world/ChunkManager.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <WillowVox/resources/Blocks.h>
+#include <shared_mutex>
+#include <algorithm>
+#include <bit>
+
+namespace WillowVox
+{
+    const glm::ivec3 Chunk::FACE_NORMALS[6] = {
+        { 0, 0, 1 }, { 0, 0, -1 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }
+    };
+
+    // FACE_NORMALS as steps between GetPaddedIndex indices
+    static const int PADDED_NEIGHBOR_STEPS[6] = {
+        1, -1, Chunk::PADDED_SIZE * Chunk::PADDED_SIZE, -Chunk::PADDED_SIZE * Chunk::PADDED_SIZE, Chunk::PADDED_SIZE, -Chunk::PADDED_SIZE
+    };
+
+    // The bits of a meshing column that hold blocks inside the chunk
+    static const uint64_t COLUMN_INTERIOR = ((1ull << CHUNK_SIZE) - 1) << 1;
+
+    // Face corners as bottom-left, bottom-right, top-left, top-right seen from outside the block
+    static const glm::ivec3 FACE_CORNERS[6][4] = {
+        { { 0, 0, 1 }, { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 } },
+        { { 1, 0, 0 }, { 0, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } },
+        { { 1, 0, 1 }, { 1, 0, 0 }, { 1, 1, 1 }, { 1, 1, 0 } },
+        { { 0, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 }, { 0, 1, 1 } },
+        { { 0, 1, 1 }, { 1, 1, 1 }, { 0, 1, 0 }, { 1, 1, 0 } },
+        { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 0, 1 }, { 1, 0, 1 } },
+    };
+    static const glm::vec2 CORNER_UVS[4] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+
+    // Two crossed quads, same corner order as FACE_CORNERS
+    static const glm::vec3 BILLBOARD_CORNERS[2][4] = {
+        { { .15f, 0, .15f }, { .85f, 0, .85f }, { .15f, 1, .15f }, { .85f, 1, .85f } },
+        { { .15f, 0, .85f }, { .85f, 0, .15f }, { .15f, 1, .85f }, { .85f, 1, .15f } },
+    };
+
+    static bool IsFaceVisible(const Block& block, uint16_t blockId, uint16_t neighborId)
+    {
+        if (neighborId == 0)
+            return true;
+
+        const Block& neighbor = Blocks::GetBlock(neighborId);
+        if (neighbor.blockType == Block::SOLID)
+            return false;
+        if (block.blockType == Block::LIQUID)
+            return neighbor.blockType != Block::LIQUID;
+
+        // Transparent blocks hide the faces between blocks of the same kind, leaves don't
+        return !(neighbor.blockType == Block::TRANSPARENT && neighborId == blockId);
+    }
+
+    static void GetFaceTexture(const Block& block, int direction, glm::vec2& min, glm::vec2& max)
+    {
+        if (direction == 4)
+        {
+            min = { block.topMinX, block.topMinY };
+            max = { block.topMaxX, block.topMaxY };
+        }
+        else if (direction == 5)
+        {
+            min = { block.bottomMinX, block.bottomMinY };
+            max = { block.bottomMaxX, block.bottomMaxY };
+        }
+        else
+        {
+            min = { block.sideMinX, block.sideMinY };
+            max = { block.sideMaxX, block.sideMaxY };
+        }
+    }
+
+    template <typename T>
+    static void UploadMesh(MeshRenderer*& meshRenderer, BaseMaterial* material, MeshVector<T>& vertices)
+    {
+        if (vertices.empty())
+        {
+            delete meshRenderer;
+            meshRenderer = nullptr;
+            return;
+        }
+
+        if (meshRenderer == nullptr)
+            meshRenderer = new MeshRenderer(*material);
+
+        Mesh* mesh = RenderingAPI::m_renderingAPI->CreateMesh();
+        mesh->SetMesh(vertices.data(), sizeof(T), (int)vertices.size() / 4);
+        meshRenderer->SetMesh(mesh, true);
+    }
+
+    // For meshing on threads that don't keep their own scratch, like edits on the main thread
+    static Chunk::MeshScratch& GetThreadScratch()
+    {
+        thread_local Chunk::MeshScratch scratch;
+        return scratch;
+    }
+
+    Chunk::Chunk(ChunkManager& chunkManager, BaseMaterial* solidMaterial, BaseMaterial* fluidMaterial, BaseMaterial* billboardMaterial, const glm::ivec3& chunkPos, const glm::vec3& worldPos)
+        : m_chunkData(nullptr), m_neighborData(), m_chunkPos(chunkPos),
+        _chunkManager(chunkManager), _worldPos(worldPos),
+        _solidMesh(nullptr), _fluidMesh(nullptr), _billboardMesh(nullptr),
+        _solidMaterial(solidMaterial), _fluidMaterial(fluidMaterial), _billboardMaterial(billboardMaterial)
+    {
+    }
+
+    Chunk::~Chunk()
+    {
+        delete _solidMesh;
+        delete _fluidMesh;
+        delete _billboardMesh;
+    }
+
+    void* Chunk::operator new(std::size_t size)
+    {
+        if (size != sizeof(Chunk))
+            return ::operator new(size);
+        return ChunkPools::GetChunkPool().Allocate();
+    }
+
+    void Chunk::operator delete(void* chunk, std::size_t size)
+    {
+        if (size != sizeof(Chunk))
+            ::operator delete(chunk);
+        else
+            ChunkPools::GetChunkPool().Free(chunk);
+    }
+
+    void Chunk::GenerateChunkMeshData(MeshScratch& scratch)
+    {
+        _retainedSections = 0;
+        RemeshSections((1u << SECTION_COUNT) - 1, scratch);
+    }
+
+    void Chunk::GenerateChunkMeshData()
+    {
+        GenerateChunkMeshData(GetThreadScratch());
+    }
+
+    void Chunk::RemeshSections(uint32_t sectionMask, MeshScratch& scratch)
+    {
+        const uint32_t allSections = (1u << SECTION_COUNT) - 1;
+        sectionMask = (sectionMask | ~_retainedSections) & allSections;
+        GenerateSectionMeshData(sectionMask, scratch);
+
+        // Splice the sections into one buffer per mesh, a chunk is still drawn with one call per material
+        const SectionMeshData* sections[SECTION_COUNT];
+        std::size_t solidCount = 0, fluidCount = 0, billboardCount = 0;
+        for (int section = 0; section < SECTION_COUNT; section++)
+        {
+            sections[section] = sectionMask >> section & 1u ? &scratch.sections[section] : &_sections[section];
+            solidCount += sections[section]->solidVertices.size();
+            fluidCount += sections[section]->fluidVertices.size();
+            billboardCount += sections[section]->billboardVertices.size();
+        }
+
+        _meshData = {};
+        _meshData.solidVertices.reserve(solidCount);
+        _meshData.fluidVertices.reserve(fluidCount);
+        _meshData.billboardVertices.reserve(billboardCount);
+        for (const SectionMeshData* section : sections)
+        {
+            _meshData.solidVertices.insert(_meshData.solidVertices.end(), section->solidVertices.begin(), section->solidVertices.end());
+            _meshData.fluidVertices.insert(_meshData.fluidVertices.end(), section->fluidVertices.begin(), section->fluidVertices.end());
+            _meshData.billboardVertices.insert(_meshData.billboardVertices.end(), section->billboardVertices.begin(), section->billboardVertices.end());
+        }
+
+        // Keep the new sections for the next partial remesh. The old ones go back to the scratch,
+        // which clears them before reuse, so their capacity isn't thrown away.
+        for (int section = 0; section < SECTION_COUNT; section++)
+        {
+            if (sectionMask >> section & 1u)
+                std::swap(_sections[section], scratch.sections[section]);
+        }
+        _retainedSections = allSections;
+        _lastRemeshedSections = sectionMask;
+    }
+
+    bool Chunk::CopyMeshBlocks(MeshScratch& scratch) const
+    {
+        // Hold every chunk we read from so an edit can't reallocate its voxels mid-copy.
+        // Locks are taken in address order so copies on other threads can't interleave badly.
+        ChunkData* sources[7] = { m_chunkData };
+        std::copy(m_neighborData, m_neighborData + 6, sources + 1);
+        std::sort(sources, sources + 7);
+        std::shared_lock<std::shared_mutex> locks[7];
+        for (int i = 0; i < 7; i++)
+        {
+            if (sources[i] != nullptr)
+                locks[i] = std::shared_lock<std::shared_mutex>(sources[i]->m_mutex);
+        }
+
+        if (m_chunkData->IsUniform() && m_chunkData->GetUniformBlock() == 0)
+            return false;
+
+        // Every block the copy writes is rewritten by the next one, so the edges and corners stay air
+        std::vector<uint16_t>& blocks = scratch.blocks;
+        if (blocks.size() != PADDED_VOLUME)
+            blocks.assign(PADDED_VOLUME, 0);
+
+        scratch.uniform = m_chunkData->IsUniform();
+        int i = 0;
+        for (int x = 0; x < CHUNK_SIZE; x++)
+        {
+            for (int y = 0; y < CHUNK_SIZE; y++)
+            {
+                uint16_t* row = &blocks[GetPaddedIndex(x, y, 0)];
+                if (scratch.uniform)
+                    std::fill(row, row + CHUNK_SIZE, m_chunkData->GetUniformBlock());
+                else
+                {
+                    for (int z = 0; z < CHUNK_SIZE; z++)
+                        row[z] = m_chunkData->GetBlockAtIndex(i + z);
+                }
+                i += CHUNK_SIZE;
+            }
+        }
+
+        // The layer of each neighbor touching this chunk goes in the border on that side
+        for (int d = 0; d < 6; d++)
+        {
+            const glm::ivec3& n = FACE_NORMALS[d];
+            int axis = n.x != 0 ? 0 : (n.y != 0 ? 1 : 2);
+            int pAxis = axis == 0 ? 1 : 0;
+            int qAxis = axis == 2 ? 1 : 2;
+            const ChunkData* neighbor = m_neighborData[d];
+
+            glm::ivec3 from, to;
+            from[axis] = n[axis] > 0 ? 0 : CHUNK_SIZE - 1;
+            to[axis] = n[axis] > 0 ? CHUNK_SIZE : -1;
+            for (int p = 0; p < CHUNK_SIZE; p++)
+            {
+                from[pAxis] = to[pAxis] = p;
+                for (int q = 0; q < CHUNK_SIZE; q++)
+                {
+                    from[qAxis] = to[qAxis] = q;
+                    blocks[GetPaddedIndex(to.x, to.y, to.z)] = neighbor != nullptr ? neighbor->GetBlock(from.x, from.y, from.z) : 0;
+                }
+            }
+        }
+        return true;
+    }
+
+    void Chunk::GenerateSectionMeshData(uint32_t sectionMask, MeshScratch& scratch)
+    {
+        SectionMeshData* sections = scratch.sections;
+        uint32_t yMask = 0;
+        for (int section = 0; section < SECTION_COUNT; section++)
+        {
+            if (!(sectionMask >> section & 1u))
+                continue;
+
+            sections[section].solidVertices.clear();
+            sections[section].fluidVertices.clear();
+            sections[section].billboardVertices.clear();
+            yMask |= ((1u << SECTION_HEIGHT) - 1) << (section * SECTION_HEIGHT);
+        }
+        if (yMask == 0 || !CopyMeshBlocks(scratch))
+            return;
+
+        // Everything from here reads the copy, edits can go ahead while the chunk is meshed.
+        // Solid blocks become bits in columns along each axis for the greedy mesher, everything
+        // else is meshed block by block.
+        const uint16_t* blocks = scratch.blocks.data();
+        std::vector<int>& otherBlocks = scratch.otherBlocks;
+        otherBlocks.clear();
+        uint64_t columns[3][CHUNK_SIZE][CHUNK_SIZE] = {};
+        auto isSolid = [](uint16_t blockId) { return blockId != 0 && Blocks::GetBlock(blockId).blockType == Block::SOLID; };
+
+        if (scratch.uniform && isSolid(blocks[GetPaddedIndex(0, 0, 0)]))
+            std::fill(&columns[0][0][0], &columns[0][0][0] + 3 * CHUNK_SIZE * CHUNK_SIZE, COLUMN_INTERIOR);
+        else
+        {
+            uint16_t lastId = 0;
+            bool lastSolid = false;
+            for (int x = 0; x < CHUNK_SIZE; x++)
+            {
+                for (int y = 0; y < CHUNK_SIZE; y++)
+                {
+                    int rowIndex = GetPaddedIndex(x, y, 0);
+                    for (int z = 0; z < CHUNK_SIZE; z++)
+                    {
+                        uint16_t blockId = blocks[rowIndex + z];
+                        if (blockId != lastId)
+                        {
+                            lastId = blockId;
+                            lastSolid = isSolid(blockId);
+                        }
+
+                        if (lastSolid)
+                        {
+                            columns[0][y][z] |= 2ull << x;
+                            columns[1][x][z] |= 2ull << y;
+                            columns[2][x][y] |= 2ull << z;
+                        }
+                        else if (blockId != 0)
+                            otherBlocks.push_back(rowIndex + z);
+                    }
+                }
+            }
+        }
+
+        // Solid border blocks cover the faces at the chunk's edge
+        for (int p = 0; p < CHUNK_SIZE; p++)
+        {
+            for (int q = 0; q < CHUNK_SIZE; q++)
+            {
+                columns[0][p][q] |= (uint64_t)isSolid(blocks[GetPaddedIndex(-1, p, q)]) | (uint64_t)isSolid(blocks[GetPaddedIndex(CHUNK_SIZE, p, q)]) << (CHUNK_SIZE + 1);
+                columns[1][p][q] |= (uint64_t)isSolid(blocks[GetPaddedIndex(p, -1, q)]) | (uint64_t)isSolid(blocks[GetPaddedIndex(p, CHUNK_SIZE, q)]) << (CHUNK_SIZE + 1);
+                columns[2][p][q] |= (uint64_t)isSolid(blocks[GetPaddedIndex(p, q, -1)]) | (uint64_t)isSolid(blocks[GetPaddedIndex(p, q, CHUNK_SIZE)]) << (CHUNK_SIZE + 1);
+            }
+        }
+
+        // The whole chunk is decoded since faces on a section's edge depend on the layers around it
+        GenerateGreedySolidMeshData(blocks, columns, yMask, sections);
+
+        for (int i : otherBlocks)
+        {
+            int y = i / PADDED_SIZE % PADDED_SIZE - 1;
+            if (!(yMask >> y & 1u))
+                continue;
+            int x = i / (PADDED_SIZE * PADDED_SIZE) - 1;
+            int z = i % PADDED_SIZE - 1;
+            uint16_t blockId = blocks[i];
+            const Block& block = Blocks::GetBlock(blockId);
+            if (block.blockType == Block::BILLBOARD)
+            {
+                AddBillboard(sections, x, y, z, block);
+                continue;
+            }
+
+            // The surface of a liquid sits a little below the top of the block
+            bool lowerTop = block.blockType == Block::LIQUID && blocks[i + PADDED_SIZE] != blockId;
+            for (int d = 0; d < 6; d++)
+            {
+                if (!IsFaceVisible(block, blockId, blocks[i + PADDED_NEIGHBOR_STEPS[d]]))
+                    continue;
+
+                if (block.blockType == Block::LIQUID)
+                    AddFluidFace(sections, x, y, z, d, block, lowerTop);
+                else
+                    AddSolidFace(sections, x, y, z, d, block, { 1, 1, 1 });
+            }
+        }
+    }
+
+    void Chunk::GenerateGreedySolidMeshData(const uint16_t* blocks, const uint64_t (&columns)[3][CHUNK_SIZE][CHUNK_SIZE], uint32_t yMask, SectionMeshData* sections)
+    {
+        for (int d = 0; d < 6; d++)
+        {
+            // Columns run along the face normal, p and q are the other two axes
+            const glm::ivec3& n = FACE_NORMALS[d];
+            int axis = n.x != 0 ? 0 : (n.y != 0 ? 1 : 2);
+            int pAxis = axis == 0 ? 1 : 0;
+            int qAxis = axis == 2 ? 1 : 2;
+            bool positive = n[axis] > 0;
+
+            // A face is visible where a solid bit isn't followed by another one along the normal,
+            // the border bits cover the faces at the chunk's edge.
+            // slices[depth][p] has bit q set for each visible face in that layer.
+            uint32_t slices[CHUNK_SIZE][CHUNK_SIZE] = {};
+            for (int p = 0; p < CHUNK_SIZE; p++)
+            {
+                for (int q = 0; q < CHUNK_SIZE; q++)
+                {
+                    uint64_t column = columns[axis][p][q];
+                    if ((column & COLUMN_INTERIOR) == 0 || (axis != 1 && !(yMask >> (axis == 0 ? p : q) & 1u)))
+                        continue;
+
+                    uint64_t covered = positive ? column >> 1 : column << 1;
+                    uint32_t faces = (uint32_t)((column & ~covered & COLUMN_INTERIOR) >> 1);
+                    if (axis == 1)
+                        faces &= yMask;
+                    while (faces != 0)
+                    {
+                        slices[std::countr_zero(faces)][p] |= 1u << q;
+                        faces &= faces - 1;
+                    }
+                }
+            }
+
+            for (int depth = 0; depth < CHUNK_SIZE; depth++)
+            {
+                uint32_t* rows = slices[depth];
+                auto blockAt = [&](int p, int q) {
+                    glm::ivec3 pos;
+                    pos[axis] = depth;
+                    pos[pAxis] = p;
+                    pos[qAxis] = q;
+                    return blocks[GetPaddedIndex(pos.x, pos.y, pos.z)];
+                };
+
+                for (int p = 0; p < CHUNK_SIZE; p++)
+                {
+                    while (rows[p] != 0)
+                    {
+                        // Grow a run of the same block along q, then grow it along p while whole rows match
+                        int q0 = std::countr_zero(rows[p]);
+                        uint16_t blockId = blockAt(p, q0);
+                        // Runs along y stop at the end of the section so each quad belongs to one section
+                        int qEnd = axis == 2 ? (q0 / SECTION_HEIGHT + 1) * SECTION_HEIGHT : CHUNK_SIZE;
+                        int pEnd = axis == 0 ? (p / SECTION_HEIGHT + 1) * SECTION_HEIGHT : CHUNK_SIZE;
+                        int q1 = q0 + 1;
+                        while (q1 < qEnd && (rows[p] >> q1 & 1u) && blockAt(p, q1) == blockId)
+                            q1++;
+                        uint32_t runMask = (q1 - q0 == 32 ? ~0u : (1u << (q1 - q0)) - 1) << q0;
+
+                        int p1 = p + 1;
+                        for (; p1 < pEnd && (rows[p1] & runMask) == runMask; p1++)
+                        {
+                            bool sameBlock = true;
+                            for (int q = q0; q < q1 && sameBlock; q++)
+                                sameBlock = blockAt(p1, q) == blockId;
+                            if (!sameBlock)
+                                break;
+                        }
+
+                        for (int row = p; row < p1; row++)
+                            rows[row] &= ~runMask;
+
+                        glm::ivec3 pos, size;
+                        pos[axis] = depth;
+                        pos[pAxis] = p;
+                        pos[qAxis] = q0;
+                        size[axis] = 1;
+                        size[pAxis] = p1 - p;
+                        size[qAxis] = q1 - q0;
+                        AddSolidFace(sections, pos.x, pos.y, pos.z, d, Blocks::GetBlock(blockId), size);
+                    }
+                }
+            }
+        }
+    }
+
+    void Chunk::AddSolidFace(SectionMeshData* sections, int x, int y, int z, int direction, const Block& block, const glm::ivec3& size)
+    {
+        // The shader repeats the tile once per block across the quad, so only the tile is stored
+        glm::vec2 texMin, texMax;
+        GetFaceTexture(block, direction, texMin, texMax);
+        int tile = ChunkVertex::GetTileIndex((int)texMin.x, (int)texMin.y);
+
+        for (int i = 0; i < 4; i++)
+        {
+            glm::ivec3 c = FACE_CORNERS[direction][i] * size;
+            sections[y / SECTION_HEIGHT].solidVertices.emplace_back(x + c.x, y + c.y, z + c.z, direction, i, tile);
+        }
+    }
+
+    void Chunk::AddFluidFace(SectionMeshData* sections, int x, int y, int z, int direction, const Block& block, bool lowerTop)
+    {
+        glm::vec2 texMin, texMax;
+        GetFaceTexture(block, direction, texMin, texMax);
+
+        for (int i = 0; i < 4; i++)
+        {
+            const glm::ivec3& c = FACE_CORNERS[direction][i];
+            glm::vec2 tex = texMin + (texMax - texMin) * CORNER_UVS[i];
+            sections[y / SECTION_HEIGHT].fluidVertices.emplace_back(x + c.x, y + c.y, z + c.z, tex, direction, lowerTop && c.y == 1);
+        }
+    }
+
+    void Chunk::AddBillboard(SectionMeshData* sections, int x, int y, int z, const Block& block)
+    {
+        glm::vec2 texMin, texMax;
+        GetFaceTexture(block, 0, texMin, texMax);
+
+        for (int quad = 0; quad < 2; quad++)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                glm::vec2 tex = texMin + (texMax - texMin) * CORNER_UVS[i];
+                sections[y / SECTION_HEIGHT].billboardVertices.emplace_back(glm::vec3(x, y, z) + BILLBOARD_CORNERS[quad][i], tex);
+            }
+        }
+    }
+
+    void Chunk::GenerateChunkMesh()
+    {
+        UploadMesh(_solidMesh, _solidMaterial, _meshData.solidVertices);
+        UploadMesh(_fluidMesh, _fluidMaterial, _meshData.fluidVertices);
+        UploadMesh(_billboardMesh, _billboardMaterial, _meshData.billboardVertices);
+        m_ready = true;
+
+        // The GPU has its own copy now
+        if (!_chunkManager.m_retainCpuMesh)
+            _meshData = {};
+    }
+
+    std::size_t Chunk::GetMeshVertexCount() const
+    {
+        return _meshData.solidVertices.size() + _meshData.fluidVertices.size() + _meshData.billboardVertices.size();
+    }
+
+    std::size_t Chunk::GetMeshDataSize() const
+    {
+        return _meshData.solidVertices.size() * sizeof(ChunkVertex) + _meshData.fluidVertices.size() * sizeof(FluidVertex)
+            + _meshData.billboardVertices.size() * sizeof(Vertex);
+    }
+
+    void Chunk::RenderSolid(const glm::mat4& view, const glm::mat4& projection)
+    {
+        if (!m_ready || _solidMesh == nullptr)
+            return;
+
+        _solidMesh->Render(view, projection, _worldPos);
+    }
+
+    void Chunk::RenderTransparent()
+    {
+        if (!m_ready)
+            return;
+
+        if (_fluidMesh != nullptr)
+            _fluidMesh->Render(_worldPos);
+        if (_billboardMesh != nullptr)
+            _billboardMesh->Render(_worldPos);
+    }
+
+    uint16_t Chunk::GetBlockIdAtPos(int x, int y, int z)
+    {
+        return m_chunkData->GetBlock(x, y, z);
+    }
+
+    void Chunk::SetBlock(int x, int y, int z, uint16_t block)
+    {
+        BlockEdit edit = { (uint16_t)m_chunkData->GetIndex(x, y, z), block };
+        ApplyEdits(&edit, 1);
+        ReloadDirtySections();
+        ReloadDirtyNeighbors();
+    }
+
+    void Chunk::ApplyEdits(const BlockEdit* edits, std::size_t count)
+    {
+        // Layers to remesh here and in each neighbor, indexed like FACE_NORMALS
+        uint32_t dirtyLayers = 0;
+        uint32_t neighborLayers[6] = {};
+        {
+            std::unique_lock<std::shared_mutex> lock(m_chunkData->m_mutex);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                m_chunkData->SetBlockAtIndex(edits[i].index, edits[i].block);
+
+                // The faces of the blocks around the edit may have changed, which reaches into
+                // the sections above and below when the block is on a section's edge
+                int x = edits[i].index / (CHUNK_SIZE * CHUNK_SIZE);
+                int y = edits[i].index / CHUNK_SIZE % CHUNK_SIZE;
+                int z = edits[i].index % CHUNK_SIZE;
+                dirtyLayers |= (uint32_t)((7ull << y) >> 1);
+                if (z == CHUNK_SIZE - 1)
+                    neighborLayers[0] |= 1u << y;
+                else if (z == 0)
+                    neighborLayers[1] |= 1u << y;
+                if (x == CHUNK_SIZE - 1)
+                    neighborLayers[2] |= 1u << y;
+                else if (x == 0)
+                    neighborLayers[3] |= 1u << y;
+                if (y == CHUNK_SIZE - 1)
+                    neighborLayers[4] |= 1u;
+                else if (y == 0)
+                    neighborLayers[5] |= 1u << (CHUNK_SIZE - 1);
+            }
+        }
+
+        MarkLayersDirty(dirtyLayers);
+        for (int d = 0; d < 6; d++)
+        {
+            if (neighborLayers[d] == 0)
+                continue;
+
+            Chunk* neighbor = _chunkManager.GetChunk(m_chunkPos + FACE_NORMALS[d]);
+            if (neighbor != nullptr)
+                neighbor->MarkLayersDirty(neighborLayers[d]);
+        }
+    }
+
+    void Chunk::ReloadChunk()
+    {
+        _dirtySections = 0;
+        GenerateChunkMeshData();
+        GenerateChunkMesh();
+    }
+
+    void Chunk::MarkLayersDirty(uint32_t layers)
+    {
+        for (int section = 0; section < SECTION_COUNT; section++)
+        {
+            if (layers >> (section * SECTION_HEIGHT) & ((1u << SECTION_HEIGHT) - 1))
+                _dirtySections |= 1u << section;
+        }
+    }
+
+    void Chunk::ReloadDirtySections()
+    {
+        if (_dirtySections == 0)
+            return;
+
+        RemeshSections(_dirtySections, GetThreadScratch());
+        _dirtySections = 0;
+        GenerateChunkMesh();
+    }
+
+    void Chunk::ReloadDirtyNeighbors()
+    {
+        for (const glm::ivec3& normal : FACE_NORMALS)
+        {
+            Chunk* neighbor = _chunkManager.GetChunk(m_chunkPos + normal);
+            if (neighbor != nullptr)
+                neighbor->ReloadDirtySections();
+        }
+    }
+}
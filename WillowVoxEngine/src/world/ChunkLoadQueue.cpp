@@ -0,0 +1,53 @@
+#include <WillowVox/world/ChunkLoadQueue.h>
+#include <WillowVox/world/WorldGlobals.h>
+#include <algorithm>
+
+namespace WillowVox
+{
+    void ChunkLoadQueue::SetView(const glm::vec3& position, const glm::vec3& front)
+    {
+        _viewPos = position;
+        _viewFront = front;
+
+        for (Entry& entry : _heap)
+            entry.score = Score(entry.pos);
+        RebuildHeap();
+    }
+
+    void ChunkLoadQueue::Push(const glm::ivec3& pos)
+    {
+        _heap.push_back({ pos, Score(pos) });
+        std::push_heap(_heap.begin(), _heap.end(), CompareEntries);
+    }
+
+    glm::ivec3 ChunkLoadQueue::Pop()
+    {
+        std::pop_heap(_heap.begin(), _heap.end(), CompareEntries);
+        glm::ivec3 pos = _heap.back().pos;
+        _heap.pop_back();
+        return pos;
+    }
+
+    float ChunkLoadQueue::Score(const glm::ivec3& pos) const
+    {
+        glm::vec3 toChunk = (glm::vec3(pos) + 0.5f) * (float)CHUNK_SIZE - _viewPos;
+        float distance = glm::length(toChunk);
+        if (distance < 0.0001f)
+            return 0.0f;
+
+        // 0 straight ahead, 2 straight behind
+        float angle = 1.0f - glm::dot(toChunk / distance, _viewFront);
+        return distance / CHUNK_SIZE * (1.0f + VIEW_ANGLE_WEIGHT * angle);
+    }
+
+    bool ChunkLoadQueue::CompareEntries(const Entry& a, const Entry& b)
+    {
+        // std heaps keep the largest element on top, so compare backwards for lowest score first
+        return a.score > b.score;
+    }
+
+    void ChunkLoadQueue::RebuildHeap()
+    {
+        std::make_heap(_heap.begin(), _heap.end(), CompareEntries);
+    }
+}
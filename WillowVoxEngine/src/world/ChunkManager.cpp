@@ -0,0 +1,587 @@
+#include <WillowVox/world/ChunkManager.h>
+#include <WillowVox/resources/Blocks.h>
+#include <algorithm>
+#include <cmath>
+
+namespace WillowVox
+{
+    // The chunk itself followed by its north, south, east, west, up and down neighbors
+    static const glm::ivec3 CHUNK_NEIGHBORHOOD[7] = {
+        { 0, 0, 0 }, { 0, 0, -1 }, { 0, 0, 1 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }
+    };
+
+    // The load queue is re-scored when the view turns further than this from the last scoring (cos 30 degrees)
+    static constexpr float VIEW_RESCORE_THRESHOLD = 0.866f;
+
+    // Integer division rounding toward negative infinity, for block to chunk coordinates
+    static int FloorDiv(int value, int divisor)
+    {
+        int quotient = value / divisor;
+        return value % divisor < 0 ? quotient - 1 : quotient;
+    }
+
+    // The chunk grids have room for the data around loaded chunks and for chunks waiting to be unloaded
+    static glm::ivec3 GetGridHalfExtent(int loadDistance, int loadHeight)
+    {
+        return glm::ivec3(loadDistance + 2, loadHeight + 2, loadDistance + 2);
+    }
+
+    ChunkManager::~ChunkManager()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_jobMutex);
+            _shouldEnd = true;
+        }
+        _jobCondition.notify_all();
+        _completedJobCondition.notify_all();
+
+        if (_chunkThread.joinable())
+            _chunkThread.join();
+        for (std::thread& worker : _workerThreads)
+            worker.join();
+
+        // Meshed chunks are still in _pendingChunks, only generated data needs collecting
+        for (ChunkJob& job : _completedJobs)
+        {
+            if (job.type == ChunkJob::GENERATE)
+                DeleteChunkData(job.chunkData);
+        }
+        for (auto& [pos, pending] : _pendingChunks)
+            delete pending.chunk;
+        for (Chunk* chunk : _chunkUploadQueue)
+            delete chunk;
+        _chunks.ForEach([](const glm::ivec3& pos, Chunk* chunk) { delete chunk; });
+        for (auto& [pos, chunkData] : _chunkData)
+            DeleteChunkData(chunkData);
+        for (ChunkData* chunkData : _chunkDataDeleteQueue)
+            DeleteChunkData(chunkData);
+    }
+
+    void ChunkManager::Start()
+    {
+        int workerCount = m_workerCount;
+        if (workerCount <= 0)
+            workerCount = std::max((int)std::thread::hardware_concurrency() - 2, 1);
+
+        // Enough to keep every worker busy without committing to chunks the player may fly away from
+        _maxPendingChunks = workerCount * 4;
+        _metricsStartTime = std::chrono::steady_clock::now();
+
+        _targetPlayerPos = _playerObj->position;
+        _targetPlayerFront = _playerObj->Front();
+        _targetLoadDistance = m_renderDistance;
+        _targetLoadHeight = m_renderHeight;
+
+        ChunkPools::SetMemoryLimit(m_poolMemoryLimit);
+
+        if (m_useChunkGrid)
+        {
+            _chunkGrid.Resize(GetGridHalfExtent(m_renderDistance, m_renderHeight));
+            _chunkDataGrid.Resize(GetGridHalfExtent(m_renderDistance, m_renderHeight));
+        }
+
+        for (int i = 0; i < workerCount; i++)
+            _workerThreads.emplace_back(&ChunkManager::WorkerThreadUpdate, this);
+        _chunkThread = std::thread(&ChunkManager::ChunkThreadUpdate, this);
+    }
+
+    void ChunkManager::Update()
+    {
+        std::vector<Chunk*> uploadQueue;
+        std::vector<glm::ivec3> unloadQueue;
+        std::vector<ChunkData*> dataDeleteQueue;
+        glm::vec3 playerPos = _playerObj->position;
+        glm::vec3 playerFront = _playerObj->Front();
+        {
+            // The chunk thread only sees the player and render distance through these copies
+            std::lock_guard<std::mutex> lock(_chunkMutex);
+            uploadQueue.swap(_chunkUploadQueue);
+            unloadQueue.swap(_chunkUnloadQueue);
+            dataDeleteQueue.swap(_chunkDataDeleteQueue);
+            _targetPlayerPos = playerPos;
+            _targetPlayerFront = playerFront;
+            _targetLoadDistance = m_renderDistance;
+            _targetLoadHeight = m_renderHeight;
+        }
+
+        // Chunks are unloaded before the data they point to is deleted
+        for (Chunk* chunk : uploadQueue)
+        {
+            chunk->GenerateChunkMesh();
+            _chunks.Insert(chunk->m_chunkPos, chunk);
+            _chunkGrid.Insert(chunk->m_chunkPos, chunk);
+        }
+        std::vector<Chunk*> unloadedChunks;
+        for (const glm::ivec3& pos : unloadQueue)
+        {
+            Chunk* chunk;
+            if (_chunks.Erase(pos, &chunk))
+            {
+                _chunkGrid.Erase(pos, chunk);
+                unloadedChunks.push_back(chunk);
+            }
+        }
+
+        // A new render distance or height rebuilds the grid around the player
+        bool gridResized = false;
+        glm::ivec3 gridHalfExtent = GetGridHalfExtent(m_renderDistance, m_renderHeight);
+        if (_chunkGrid.Enabled() && _chunkGrid.GetHalfExtent() != gridHalfExtent)
+        {
+            _chunkGrid.Resize(gridHalfExtent);
+            gridResized = true;
+        }
+        _chunkGrid.SetCenter(glm::floor(playerPos / (float)CHUNK_SIZE), [this](const glm::ivec3& pos) { return _chunks.Find(pos, nullptr); });
+
+        // Readers on other threads may still be using what was just unloaded, or the old grid
+        if (!uploadQueue.empty() || !unloadedChunks.empty() || !dataDeleteQueue.empty() || gridResized)
+            _chunks.Synchronize();
+        _chunkGrid.FreeRetired();
+        for (Chunk* chunk : unloadedChunks)
+            delete chunk;
+        for (ChunkData* chunkData : dataDeleteQueue)
+            DeleteChunkData(chunkData);
+
+        auto now = std::chrono::steady_clock::now();
+        float elapsed = std::chrono::duration<float>(now - _metricsStartTime).count();
+        if (elapsed >= 1.0f)
+        {
+            uint64_t generated = _generatedChunkCount;
+            uint64_t meshed = _meshedChunkCount;
+            _generatedChunksPerSecond = (generated - _lastGeneratedChunkCount) / elapsed;
+            _meshedChunksPerSecond = (meshed - _lastMeshedChunkCount) / elapsed;
+            _lastGeneratedChunkCount = generated;
+            _lastMeshedChunkCount = meshed;
+            _metricsStartTime = now;
+        }
+    }
+
+    void ChunkManager::Render(Camera& camera)
+    {
+        glm::mat4 view = camera.GetViewMatrix();
+        glm::mat4 projection = camera.GetProjectionMatrix();
+
+        _chunks.ForEach([&](const glm::ivec3& pos, Chunk* chunk) { chunk->RenderSolid(view, projection); });
+        _chunks.ForEach([](const glm::ivec3& pos, Chunk* chunk) { chunk->RenderTransparent(); });
+    }
+
+    Chunk* ChunkManager::GetChunk(int x, int y, int z)
+    {
+        return GetChunk(glm::ivec3(x, y, z));
+    }
+
+    Chunk* ChunkManager::GetChunk(glm::ivec3 pos)
+    {
+        ChunkReadGuard guard(_chunks);
+        if (Chunk* chunk = _chunkGrid.Find(pos))
+            return chunk;
+        return _chunks.Find(pos, nullptr);
+    }
+
+    Chunk* ChunkManager::GetChunkAtPos(float x, float y, float z)
+    {
+        return GetChunk((int)std::floor(x / CHUNK_SIZE), (int)std::floor(y / CHUNK_SIZE), (int)std::floor(z / CHUNK_SIZE));
+    }
+
+    Chunk* ChunkManager::GetChunkAtPos(glm::vec3 pos)
+    {
+        return GetChunkAtPos(pos.x, pos.y, pos.z);
+    }
+
+    uint16_t ChunkManager::GetBlockIdAtPos(float x, float y, float z)
+    {
+        Chunk* chunk = GetChunkAtPos(x, y, z);
+        if (chunk == nullptr)
+            return 0;
+
+        int blockX = (int)std::floor(x) - chunk->m_chunkPos.x * CHUNK_SIZE;
+        int blockY = (int)std::floor(y) - chunk->m_chunkPos.y * CHUNK_SIZE;
+        int blockZ = (int)std::floor(z) - chunk->m_chunkPos.z * CHUNK_SIZE;
+        return chunk->GetBlockIdAtPos(blockX, blockY, blockZ);
+    }
+
+    uint16_t ChunkManager::GetBlockIdAtPos(glm::vec3 pos)
+    {
+        return GetBlockIdAtPos(pos.x, pos.y, pos.z);
+    }
+
+    Block* ChunkManager::GetBlockAtPos(float x, float y, float z)
+    {
+        return &Blocks::GetBlock(GetBlockIdAtPos(x, y, z));
+    }
+
+    Block* ChunkManager::GetBlockAtPos(glm::vec3 pos)
+    {
+        return GetBlockAtPos(pos.x, pos.y, pos.z);
+    }
+
+    void ChunkManager::SetBlockAtPos(int x, int y, int z, uint16_t block)
+    {
+        glm::ivec3 chunkPos(FloorDiv(x, CHUNK_SIZE), FloorDiv(y, CHUNK_SIZE), FloorDiv(z, CHUNK_SIZE));
+        int blockX = x - chunkPos.x * CHUNK_SIZE;
+        int blockY = y - chunkPos.y * CHUNK_SIZE;
+        int blockZ = z - chunkPos.z * CHUNK_SIZE;
+
+        if (!_editBatchActive)
+        {
+            Chunk* chunk = GetChunk(chunkPos);
+            if (chunk != nullptr)
+                chunk->SetBlock(blockX, blockY, blockZ, block);
+            return;
+        }
+
+        if (_lastEditChunk == nullptr || chunkPos != _lastEditChunkPos)
+        {
+            _lastEditChunk = &_editBatch[chunkPos];
+            _lastEditChunkPos = chunkPos;
+        }
+        _lastEditChunk->push_back({ (uint16_t)(blockX * CHUNK_SIZE * CHUNK_SIZE + blockY * CHUNK_SIZE + blockZ), block });
+    }
+
+    void ChunkManager::BeginEditBatch()
+    {
+        _editBatchActive = true;
+    }
+
+    void ChunkManager::CommitEditBatch()
+    {
+        // Apply everything before remeshing so a chunk touched by several edited chunks is only remeshed once
+        std::vector<Chunk*> editedChunks;
+        for (auto& [pos, edits] : _editBatch)
+        {
+            Chunk* chunk = GetChunk(pos);
+            if (chunk == nullptr)
+                continue;
+
+            chunk->ApplyEdits(edits.data(), edits.size());
+            editedChunks.push_back(chunk);
+        }
+
+        for (Chunk* chunk : editedChunks)
+        {
+            chunk->ReloadDirtySections();
+            chunk->ReloadDirtyNeighbors();
+        }
+
+        _editBatch.clear();
+        _lastEditChunk = nullptr;
+        _editBatchActive = false;
+    }
+
+    void ChunkManager::ClearChunkQueue()
+    {
+        _shouldClearChunkQueue = true;
+    }
+
+    void ChunkManager::SetPlayerObj(Camera* camera)
+    {
+        _playerObj = camera;
+    }
+
+    void ChunkManager::ChunkThreadUpdate()
+    {
+        while (!_shouldEnd)
+        {
+            glm::vec3 playerPos, playerFront;
+            int loadDistance, loadHeight;
+            {
+                std::lock_guard<std::mutex> lock(_chunkMutex);
+                playerPos = _targetPlayerPos;
+                playerFront = _targetPlayerFront;
+                loadDistance = _targetLoadDistance;
+                loadHeight = _targetLoadHeight;
+            }
+
+            glm::ivec3 playerChunk = glm::floor(playerPos / (float)CHUNK_SIZE);
+            glm::ivec3 previousPlayerChunk(_playerChunkX, _playerChunkY, _playerChunkZ);
+            bool playerMoved = playerChunk != previousPlayerChunk;
+            bool rangeChanged = loadDistance != _loadDistance || loadHeight != _loadHeight;
+            bool rebuildQueue = _shouldClearChunkQueue.exchange(false) || rangeChanged;
+            if (rebuildQueue || playerMoved)
+            {
+                _playerChunkX = playerChunk.x;
+                _playerChunkY = playerChunk.y;
+                _playerChunkZ = playerChunk.z;
+                _loadDistance = loadDistance;
+                _loadHeight = loadHeight;
+
+                UnloadChunks();
+                // Only this thread reads the data grid, so the old one can go right away
+                if (rangeChanged && _chunkDataGrid.Enabled())
+                {
+                    _chunkDataGrid.Resize(GetGridHalfExtent(loadDistance, loadHeight));
+                    _chunkDataGrid.FreeRetired();
+                }
+                _chunkDataGrid.SetCenter(playerChunk, [this](const glm::ivec3& pos) {
+                    auto it = _chunkData.find(pos);
+                    return it != _chunkData.end() ? it->second : nullptr;
+                });
+
+                // Moving keeps the queued chunks that are still in range and only adds the ones that came into range
+                if (rebuildQueue)
+                    _chunkQueue.Clear();
+                else
+                    _chunkQueue.RemoveIf([this](const glm::ivec3& pos) { return !IsInRange(pos, 0); });
+                _chunkQueue.SetView(playerPos, playerFront);
+                QueueChunksInRange(!rebuildQueue, previousPlayerChunk);
+            }
+            else if (glm::dot(playerFront, _chunkQueue.GetViewFront()) < VIEW_RESCORE_THRESHOLD)
+            {
+                _chunkQueue.SetView(playerPos, playerFront);
+            }
+
+            // Only a bounded number of chunks are in flight so the queue can still change under them
+            while (!_chunkQueue.Empty() && (int)_pendingChunks.size() < _maxPendingChunks)
+                RequestChunk(_chunkQueue.Pop());
+
+            std::vector<ChunkJob> completedJobs;
+            {
+                std::unique_lock<std::mutex> lock(_completedJobMutex);
+                _completedJobCondition.wait_for(lock, std::chrono::milliseconds(5), [this] { return !_completedJobs.empty() || _shouldEnd; });
+                if (_shouldEnd)
+                    return;
+                completedJobs.swap(_completedJobs);
+            }
+
+            for (ChunkJob& job : completedJobs)
+            {
+                if (job.type == ChunkJob::GENERATE)
+                    OnChunkDataGenerated(job.pos, job.chunkData);
+                else
+                    OnChunkMeshed(job.chunk);
+            }
+        }
+    }
+
+    void ChunkManager::WorkerThreadUpdate()
+    {
+        Chunk::MeshScratch meshScratch;
+        while (true)
+        {
+            ChunkJob job;
+            {
+                std::unique_lock<std::mutex> lock(_jobMutex);
+                _jobCondition.wait(lock, [this] { return !_jobQueue.empty() || _shouldEnd; });
+                if (_shouldEnd)
+                    return;
+                job = _jobQueue.front();
+                _jobQueue.pop_front();
+            }
+
+            if (job.type == ChunkJob::GENERATE)
+            {
+                job.chunkData = new ChunkData();
+                job.chunkData->m_offset = job.pos * CHUNK_SIZE;
+                // A chunk that fails to load, like a corrupt file, is generated instead
+                if (m_worldSave == nullptr || !m_worldSave->HasChunk(job.pos) || !m_worldSave->LoadChunkData(*job.chunkData))
+                {
+                    _worldGen.GenerateChunkData(*job.chunkData);
+                    job.chunkData->m_generated = true;
+                }
+                _generatedChunkCount++;
+            }
+            else
+            {
+                job.chunk->GenerateChunkMeshData(meshScratch);
+                _meshedChunkCount++;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_completedJobMutex);
+                _completedJobs.push_back(job);
+            }
+            _completedJobCondition.notify_one();
+        }
+    }
+
+    void ChunkManager::PushJob(const ChunkJob& job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_jobMutex);
+            _jobQueue.push_back(job);
+        }
+        _jobCondition.notify_one();
+    }
+
+    void ChunkManager::QueueChunksInRange(bool onlyEntered, const glm::ivec3& previousPlayerChunk)
+    {
+        glm::ivec3 playerChunk(_playerChunkX, _playerChunkY, _playerChunkZ);
+        for (int x = -_loadDistance; x <= _loadDistance; x++)
+        {
+            for (int y = -_loadHeight; y <= _loadHeight; y++)
+            {
+                for (int z = -_loadDistance; z <= _loadDistance; z++)
+                {
+                    glm::ivec3 pos = playerChunk + glm::ivec3(x, y, z);
+                    glm::ivec3 previousOffset = glm::abs(pos - previousPlayerChunk);
+                    if (onlyEntered && previousOffset.x <= _loadDistance && previousOffset.y <= _loadHeight && previousOffset.z <= _loadDistance)
+                        continue;
+
+                    if (_loadedChunks.count(pos) == 0 && _pendingChunks.count(pos) == 0)
+                        _chunkQueue.Push(pos);
+                }
+            }
+        }
+    }
+
+    void ChunkManager::RequestChunk(const glm::ivec3& pos)
+    {
+        if (_loadedChunks.count(pos) != 0 || _pendingChunks.count(pos) != 0)
+            return;
+
+        Chunk* chunk = new Chunk(*this, m_solidMaterial, m_fluidMaterial, m_billboardMaterial, pos, glm::vec3(pos * CHUNK_SIZE));
+
+        int missingData = 0;
+        for (const glm::ivec3& offset : CHUNK_NEIGHBORHOOD)
+        {
+            glm::ivec3 dataPos = pos + offset;
+            if (FindChunkData(dataPos) != nullptr)
+                continue;
+
+            missingData++;
+            if (_generatingData.insert(dataPos).second)
+                PushJob({ ChunkJob::GENERATE, dataPos });
+        }
+
+        PendingChunk& pending = _pendingChunks[pos];
+        pending = { chunk, missingData };
+        if (missingData == 0)
+            DispatchMesh(pending);
+    }
+
+    void ChunkManager::DispatchMesh(PendingChunk& pending)
+    {
+        Chunk* chunk = pending.chunk;
+        const glm::ivec3& pos = chunk->m_chunkPos;
+        chunk->m_chunkData = FindChunkData(pos);
+        for (int d = 0; d < 6; d++)
+            chunk->m_neighborData[d] = FindChunkData(pos + Chunk::FACE_NORMALS[d]);
+
+        PushJob({ ChunkJob::MESH, pos, chunk });
+    }
+
+    void ChunkManager::OnChunkDataGenerated(const glm::ivec3& pos, ChunkData* chunkData)
+    {
+        _generatingData.erase(pos);
+
+        // Nothing in range can be waiting on data outside of it
+        if (!IsInRange(pos, 1))
+        {
+            DeleteChunkData(chunkData);
+            return;
+        }
+
+        InsertChunkData(pos, chunkData);
+
+        // Every chunk requested before this data existed counted it as missing
+        for (const glm::ivec3& offset : CHUNK_NEIGHBORHOOD)
+        {
+            auto it = _pendingChunks.find(pos - offset);
+            if (it != _pendingChunks.end() && it->second.missingData > 0 && --it->second.missingData == 0)
+                DispatchMesh(it->second);
+        }
+    }
+
+    void ChunkManager::OnChunkMeshed(Chunk* chunk)
+    {
+        _pendingChunks.erase(chunk->m_chunkPos);
+
+        // Never uploaded, so it holds no meshes and can be deleted off the main thread
+        if (!IsInRange(chunk->m_chunkPos, 0))
+        {
+            delete chunk;
+            return;
+        }
+
+        _loadedChunks.insert(chunk->m_chunkPos);
+
+        std::lock_guard<std::mutex> lock(_chunkMutex);
+        _chunkUploadQueue.push_back(chunk);
+    }
+
+    void ChunkManager::UnloadChunks()
+    {
+        std::vector<glm::ivec3> unloadedChunks;
+        std::vector<ChunkData*> unloadedData;
+
+        for (auto it = _loadedChunks.begin(); it != _loadedChunks.end();)
+        {
+            if (IsInRange(*it, 0))
+            {
+                ++it;
+                continue;
+            }
+            unloadedChunks.push_back(*it);
+            it = _loadedChunks.erase(it);
+        }
+
+        // Chunks being meshed are dropped when their job completes
+        for (auto it = _pendingChunks.begin(); it != _pendingChunks.end();)
+        {
+            if (IsInRange(it->first, 0) || it->second.missingData == 0)
+            {
+                ++it;
+                continue;
+            }
+            delete it->second.chunk;
+            it = _pendingChunks.erase(it);
+        }
+
+        for (auto it = _chunkData.begin(); it != _chunkData.end();)
+        {
+            if (IsInRange(it->first, 1) || IsChunkDataInUse(it->first))
+            {
+                ++it;
+                continue;
+            }
+            unloadedData.push_back(it->second);
+            _chunkDataGrid.Erase(it->first, it->second);
+            it = _chunkData.erase(it);
+        }
+
+        if (unloadedChunks.empty() && unloadedData.empty())
+            return;
+
+        std::lock_guard<std::mutex> lock(_chunkMutex);
+        _chunkUnloadQueue.insert(_chunkUnloadQueue.end(), unloadedChunks.begin(), unloadedChunks.end());
+        _chunkDataDeleteQueue.insert(_chunkDataDeleteQueue.end(), unloadedData.begin(), unloadedData.end());
+    }
+
+    ChunkData* ChunkManager::FindChunkData(const glm::ivec3& pos) const
+    {
+        if (ChunkData* chunkData = _chunkDataGrid.Find(pos))
+            return chunkData;
+        auto it = _chunkData.find(pos);
+        return it != _chunkData.end() ? it->second : nullptr;
+    }
+
+    void ChunkManager::InsertChunkData(const glm::ivec3& pos, ChunkData* chunkData)
+    {
+        _chunkData[pos] = chunkData;
+        _chunkDataGrid.Insert(pos, chunkData);
+    }
+
+    void ChunkManager::DeleteChunkData(ChunkData* chunkData)
+    {
+        if (chunkData->m_generated)
+            _worldGen.OnChunkDataUnloaded(*chunkData);
+        delete chunkData;
+    }
+
+    bool ChunkManager::IsInRange(const glm::ivec3& pos, int padding) const
+    {
+        return std::abs(pos.x - _playerChunkX) <= _loadDistance + padding
+            && std::abs(pos.y - _playerChunkY) <= _loadHeight + padding
+            && std::abs(pos.z - _playerChunkZ) <= _loadDistance + padding;
+    }
+
+    bool ChunkManager::IsChunkDataInUse(const glm::ivec3& pos) const
+    {
+        for (const glm::ivec3& offset : CHUNK_NEIGHBORHOOD)
+        {
+            auto it = _pendingChunks.find(pos - offset);
+            if (it != _pendingChunks.end() && it->second.missingData == 0)
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,201 @@
+#include <WillowVox/world/ChunkPool.h>
+#include <WillowVox/world/Chunk.h>
+#include <WillowVox/world/ChunkData.h>
+#include <WillowVox/world/WorldGlobals.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+
+namespace WillowVox
+{
+    static std::atomic<std::size_t> slabMemory = 0;
+    static std::atomic<std::size_t> memoryLimit = (std::size_t)1024 * 1024 * 1024;
+
+    // Counts a new slab against the memory limit, false if it doesn't fit
+    static bool ReserveSlabMemory(std::size_t size)
+    {
+        std::size_t used = slabMemory.load(std::memory_order_relaxed);
+        do
+        {
+            if (used + size > memoryLimit.load(std::memory_order_relaxed))
+                return false;
+        } while (!slabMemory.compare_exchange_weak(used, used + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    SlabPool::SlabPool(const char* name, std::size_t blockSize) : _name(name)
+    {
+        // Blocks keep the heap's alignment and are big enough to hold the free list link
+        const std::size_t alignment = alignof(std::max_align_t);
+        _blockSize = (std::max(blockSize, sizeof(void*)) + alignment - 1) / alignment * alignment;
+        _blocksPerSlab = std::max<std::size_t>(SLAB_SIZE / _blockSize, 1);
+    }
+
+    SlabPool::~SlabPool()
+    {
+        for (char* slab : _slabs)
+            ::operator delete(slab);
+        slabMemory -= _slabs.size() * _blocksPerSlab * _blockSize;
+    }
+
+    void* SlabPool::Allocate()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        void* block;
+        if (_freeList != nullptr)
+        {
+            block = _freeList;
+            _freeList = *static_cast<void**>(block);
+            _free--;
+        }
+        else if (_unusedInSlab > 0)
+        {
+            block = _newestSlab + (_blocksPerSlab - _unusedInSlab) * _blockSize;
+            _unusedInSlab--;
+        }
+        else if (ReserveSlabMemory(_blocksPerSlab * _blockSize))
+        {
+            char* slab = static_cast<char*>(::operator new(_blocksPerSlab * _blockSize));
+            _slabs.insert(std::upper_bound(_slabs.begin(), _slabs.end(), slab, std::less<const char*>()), slab);
+            _newestSlab = slab;
+            _unusedInSlab = _blocksPerSlab - 1;
+            block = slab;
+        }
+        else
+        {
+            block = ::operator new(_blockSize);
+            _overflow++;
+        }
+
+        _live++;
+        _highWater = std::max(_highWater, _live);
+        return block;
+    }
+
+    void SlabPool::Free(void* block)
+    {
+        if (block == nullptr)
+            return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _live--;
+        if (!IsInSlab(block))
+        {
+            ::operator delete(block);
+            _overflow--;
+            return;
+        }
+
+        *static_cast<void**>(block) = _freeList;
+        _freeList = block;
+        _free++;
+    }
+
+    SlabPool::Stats SlabPool::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return { _name, _blockSize, _live, _free + _unusedInSlab, _highWater, _overflow, _slabs.size() * _blocksPerSlab * _blockSize };
+    }
+
+    bool SlabPool::IsInSlab(const void* block) const
+    {
+        const char* address = static_cast<const char*>(block);
+        auto it = std::upper_bound(_slabs.begin(), _slabs.end(), address, std::less<const char*>());
+        if (it == _slabs.begin())
+            return false;
+        --it;
+        return std::less<const char*>()(address, *it + _blocksPerSlab * _blockSize);
+    }
+
+    // Pools are never destroyed so chunks freed during static destruction still have somewhere to go
+    static constexpr int VOXEL_POOL_COUNT = 5;
+    static constexpr int MESH_POOL_COUNT = std::countr_zero(ChunkPools::MAX_POOLED_MESH_SIZE / ChunkPools::MIN_POOLED_MESH_SIZE) + 1;
+
+    static SlabPool& GetVoxelPoolAt(int index)
+    {
+        static SlabPool* pools[VOXEL_POOL_COUNT] = {
+            new SlabPool("Voxels 1 bit", CHUNK_VOLUME / 8), new SlabPool("Voxels 2 bit", CHUNK_VOLUME / 4),
+            new SlabPool("Voxels 4 bit", CHUNK_VOLUME / 2), new SlabPool("Voxels 8 bit", CHUNK_VOLUME),
+            new SlabPool("Voxels 16 bit", CHUNK_VOLUME * 2)
+        };
+        return *pools[index];
+    }
+
+    // Power of two sizes from MIN_POOLED_MESH_SIZE
+    static SlabPool& GetMeshPoolAt(int index)
+    {
+        static SlabPool* pools[MESH_POOL_COUNT] = {
+            new SlabPool("Mesh 1 KB", 1024), new SlabPool("Mesh 2 KB", 2048), new SlabPool("Mesh 4 KB", 4096),
+            new SlabPool("Mesh 8 KB", 8192), new SlabPool("Mesh 16 KB", 16384), new SlabPool("Mesh 32 KB", 32768),
+            new SlabPool("Mesh 64 KB", 65536), new SlabPool("Mesh 128 KB", 131072), new SlabPool("Mesh 256 KB", 262144)
+        };
+        return *pools[index];
+    }
+
+    static int GetMeshPoolIndex(std::size_t size)
+    {
+        return std::bit_width((std::max(size, ChunkPools::MIN_POOLED_MESH_SIZE) - 1) / ChunkPools::MIN_POOLED_MESH_SIZE);
+    }
+
+    SlabPool& ChunkPools::GetChunkPool()
+    {
+        static SlabPool* pool = new SlabPool("Chunks", sizeof(Chunk));
+        return *pool;
+    }
+
+    SlabPool& ChunkPools::GetChunkDataPool()
+    {
+        static SlabPool* pool = new SlabPool("Chunk data", sizeof(ChunkData));
+        return *pool;
+    }
+
+    SlabPool& ChunkPools::GetVoxelPool(int bitsPerVoxel)
+    {
+        return GetVoxelPoolAt(std::countr_zero((unsigned)bitsPerVoxel));
+    }
+
+    void* ChunkPools::AllocateMeshData(std::size_t size)
+    {
+        if (size > MAX_POOLED_MESH_SIZE)
+            return ::operator new(size);
+        return GetMeshPoolAt(GetMeshPoolIndex(size)).Allocate();
+    }
+
+    void ChunkPools::FreeMeshData(void* data, std::size_t size)
+    {
+        if (size > MAX_POOLED_MESH_SIZE)
+        {
+            ::operator delete(data);
+            return;
+        }
+        GetMeshPoolAt(GetMeshPoolIndex(size)).Free(data);
+    }
+
+    void ChunkPools::SetMemoryLimit(std::size_t bytes)
+    {
+        memoryLimit = bytes;
+    }
+
+    std::size_t ChunkPools::GetMemoryLimit()
+    {
+        return memoryLimit;
+    }
+
+    std::size_t ChunkPools::GetSlabMemory()
+    {
+        return slabMemory;
+    }
+
+    std::vector<SlabPool::Stats> ChunkPools::GetStats()
+    {
+        std::vector<SlabPool::Stats> stats;
+        stats.push_back(GetChunkPool().GetStats());
+        stats.push_back(GetChunkDataPool().GetStats());
+        for (int i = 0; i < VOXEL_POOL_COUNT; i++)
+            stats.push_back(GetVoxelPoolAt(i).GetStats());
+        for (int i = 0; i < MESH_POOL_COUNT; i++)
+            stats.push_back(GetMeshPoolAt(i).GetStats());
+        return stats;
+    }
+}
@@ -0,0 +1,367 @@
+#include <WillowVox/world/TerrainGen.h>
+#include <WillowVox/math/Noise.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <vector>
+
+namespace WillowVox
+{
+    static int64_t GetColumnKey(int x, int z)
+    {
+        return ((int64_t)x << 32) | (uint32_t)z;
+    }
+
+    TerrainGen::~TerrainGen()
+    {
+        for (auto& [key, heightmap] : _heightmaps)
+            delete heightmap;
+    }
+
+    void TerrainGen::GenerateChunkData(ChunkData& chunkData)
+    {
+        // Released by OnChunkDataUnloaded, keeping the columns cached for the chunks above and below
+        AcquireHeightmap(chunkData);
+        AcquireFeatureColumns(chunkData);
+
+        GenerateChunkBlocks(chunkData);
+        GenerateSurfaceFeatures(chunkData);
+        chunkData.Compact();
+    }
+
+    void TerrainGen::OnChunkDataUnloaded(const ChunkData& chunkData)
+    {
+        ReleaseFeatureColumns(chunkData);
+        ReleaseHeightmap(chunkData);
+    }
+
+    TerrainGen::ChunkClass TerrainGen::ClassifyChunk(const ChunkData& chunkData)
+    {
+        // The world wide bounds settle most chunks without computing their column
+        int minSurfaceBlock, maxSurfaceBlock;
+        GetSurfaceBounds(minSurfaceBlock, maxSurfaceBlock);
+        ChunkClass chunkClass = ClassifyChunk(chunkData.m_offset.y, minSurfaceBlock, maxSurfaceBlock);
+        if (chunkClass != MIXED)
+            return chunkClass;
+
+        const ColumnHeightmap& heightmap = AcquireHeightmap(chunkData);
+        chunkClass = ClassifyChunk(chunkData.m_offset.y, heightmap.minSurfaceBlock, heightmap.maxSurfaceBlock);
+        ReleaseHeightmap(chunkData);
+        return chunkClass;
+    }
+
+    void TerrainGen::GetSurfaceBounds(int& minSurfaceBlock, int& maxSurfaceBlock)
+    {
+        // Each layer is remapped from [-1, 1] noise, which Perlin can overshoot slightly, so the bounds are padded
+        float minHeight = 0.0f, maxHeight = 0.0f;
+        for (int i = 0; i < m_surfaceNoiseLayers; i++)
+        {
+            NoiseSettings2D& settings = m_surfaceNoiseSettings[i];
+            float padding = std::abs(settings.m_amplitude) * 0.01f;
+            minHeight += settings.m_heightOffset + std::min(settings.m_amplitude, 0.0f) - padding;
+            maxHeight += settings.m_heightOffset + std::max(settings.m_amplitude, 0.0f) + padding;
+        }
+        minSurfaceBlock = (int)std::floor(minHeight);
+        maxSurfaceBlock = (int)std::floor(maxHeight);
+    }
+
+    const TerrainGen::ColumnHeightmap& TerrainGen::AcquireHeightmap(const ChunkData& chunkData)
+    {
+        return AcquireHeightmap(chunkData.m_offset.x, chunkData.m_offset.z);
+    }
+
+    void TerrainGen::ReleaseHeightmap(const ChunkData& chunkData)
+    {
+        ReleaseHeightmap(chunkData.m_offset.x, chunkData.m_offset.z);
+    }
+
+    const TerrainGen::ColumnHeightmap& TerrainGen::AcquireHeightmap(int x, int z)
+    {
+        ColumnHeightmap* heightmap;
+        {
+            std::lock_guard<std::mutex> lock(_heightmapMutex);
+            ColumnHeightmap*& entry = _heightmaps[GetColumnKey(x, z)];
+            if (entry == nullptr)
+                entry = new ColumnHeightmap();
+            entry->refCount++;
+            heightmap = entry;
+        }
+
+        // Filled outside the lock so different columns generate in parallel,
+        // other chunks of this column wait here until it's done
+        std::call_once(heightmap->computed, [&] {
+            GetSurfaceBlocks(x, z, heightmap->surfaceBlocks);
+            heightmap->minSurfaceBlock = INT_MAX;
+            heightmap->maxSurfaceBlock = INT_MIN;
+            for (int lx = 0; lx < CHUNK_SIZE; lx++)
+            {
+                for (int lz = 0; lz < CHUNK_SIZE; lz++)
+                {
+                    heightmap->minSurfaceBlock = std::min(heightmap->minSurfaceBlock, heightmap->surfaceBlocks[lx][lz]);
+                    heightmap->maxSurfaceBlock = std::max(heightmap->maxSurfaceBlock, heightmap->surfaceBlocks[lx][lz]);
+                }
+            }
+            FindSurfaceFeatureAnchors(x, z, heightmap->surfaceBlocks, heightmap->featureAnchors);
+        });
+        return *heightmap;
+    }
+
+    void TerrainGen::ReleaseHeightmap(int x, int z)
+    {
+        std::lock_guard<std::mutex> lock(_heightmapMutex);
+        auto it = _heightmaps.find(GetColumnKey(x, z));
+        if (it == _heightmaps.end() || --it->second->refCount > 0)
+            return;
+
+        delete it->second;
+        _heightmaps.erase(it);
+    }
+
+    void TerrainGen::GenerateChunkBlocks(ChunkData& chunkData)
+    {
+        // Picks blocks through the virtual functions
+        FillChunkBlocks(chunkData, *this);
+    }
+
+    void TerrainGen::SampleCaveAndOreNoise(const ChunkData& chunkData, int noiseHeight, std::vector<uint8_t>& isCave, std::vector<int32_t>& ores)
+    {
+        int noiseVolume = CHUNK_SIZE * noiseHeight * CHUNK_SIZE;
+        std::vector<float> noise(noiseVolume);
+        isCave.assign(noiseVolume, false);
+        ores.assign(noiseVolume, -1);
+        for (int l = 0; l < m_caveNoiseLayers; l++)
+        {
+            Noise::GetUpsampledValues3D(m_caveNoiseSettings[l], m_seed, chunkData.m_offset.x, chunkData.m_offset.y, chunkData.m_offset.z,
+                CHUNK_SIZE, noiseHeight, CHUNK_SIZE, noise.data());
+            for (int i = 0; i < noiseVolume; i++)
+            {
+                if (noise[i] > m_caveNoiseSettings[l].m_noiseThreshold)
+                    isCave[i] = true;
+            }
+        }
+        for (int l = 0; l < m_oreNoiseLayers; l++)
+        {
+            Noise::GetUpsampledValues3D(m_oreNoiseSettings[l], m_seed, chunkData.m_offset.x, chunkData.m_offset.y, chunkData.m_offset.z,
+                CHUNK_SIZE, noiseHeight, CHUNK_SIZE, noise.data());
+            // The first layer above its threshold picks the ore, like IsOre
+            for (int i = 0; i < noiseVolume; i++)
+            {
+                if (ores[i] < 0 && noise[i] > m_oreNoiseSettings[l].m_noiseThreshold)
+                    ores[i] = m_oreNoiseSettings[l].m_replaceBlock;
+            }
+        }
+    }
+
+    bool TerrainGen::GetFeatureReach(const ChunkData& chunkData, FeatureReach& reach)
+    {
+        if (m_surfaceFeatureCount == 0)
+            return false;
+
+        int minX = INT_MAX, maxX = INT_MIN, minZ = INT_MAX, maxZ = INT_MIN;
+        reach.minY = INT_MAX;
+        reach.maxY = INT_MIN;
+        for (int i = 0; i < m_surfaceFeatureCount; i++)
+        {
+            SurfaceFeature& feature = m_surfaceFeatures[i];
+            minX = std::min(minX, feature.offsetX);
+            maxX = std::max(maxX, feature.offsetX + feature.sizeX - 1);
+            reach.minY = std::min(reach.minY, feature.offsetY);
+            reach.maxY = std::max(reach.maxY, feature.offsetY + feature.sizeY - 1);
+            minZ = std::min(minZ, feature.offsetZ);
+            maxZ = std::max(maxZ, feature.offsetZ + feature.sizeZ - 1);
+        }
+        reach.minColumnX = -((maxX + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        reach.maxColumnX = (-minX + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        reach.minColumnZ = -((maxZ + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        reach.maxColumnZ = (-minZ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+        // Chunks out of reach of any surface skip looking at the neighboring columns
+        int minSurfaceBlock, maxSurfaceBlock;
+        GetSurfaceBounds(minSurfaceBlock, maxSurfaceBlock);
+        return chunkData.m_offset.y + CHUNK_SIZE - 1 >= minSurfaceBlock + reach.minY && chunkData.m_offset.y <= maxSurfaceBlock + reach.maxY;
+    }
+
+    void TerrainGen::AcquireFeatureColumns(const ChunkData& chunkData)
+    {
+        FeatureReach reach;
+        if (!GetFeatureReach(chunkData, reach))
+            return;
+        for (int cx = reach.minColumnX; cx <= reach.maxColumnX; cx++)
+            for (int cz = reach.minColumnZ; cz <= reach.maxColumnZ; cz++)
+                AcquireHeightmap(chunkData.m_offset.x + cx * CHUNK_SIZE, chunkData.m_offset.z + cz * CHUNK_SIZE);
+    }
+
+    void TerrainGen::ReleaseFeatureColumns(const ChunkData& chunkData)
+    {
+        FeatureReach reach;
+        if (!GetFeatureReach(chunkData, reach))
+            return;
+        for (int cx = reach.minColumnX; cx <= reach.maxColumnX; cx++)
+            for (int cz = reach.minColumnZ; cz <= reach.maxColumnZ; cz++)
+                ReleaseHeightmap(chunkData.m_offset.x + cx * CHUNK_SIZE, chunkData.m_offset.z + cz * CHUNK_SIZE);
+    }
+
+    void TerrainGen::GenerateSurfaceFeatures(ChunkData& chunkData)
+    {
+        FeatureReach reach;
+        if (!GetFeatureReach(chunkData, reach))
+            return;
+
+        // Anchors from every column that can reach this chunk, placed in world x then z order so
+        // overlapping features come out the same no matter which chunk places them. GenerateChunkData
+        // already holds these columns, so acquiring them here only looks them up.
+        std::vector<SurfaceFeatureAnchor> anchors;
+        for (int cx = reach.minColumnX; cx <= reach.maxColumnX; cx++)
+        {
+            for (int cz = reach.minColumnZ; cz <= reach.maxColumnZ; cz++)
+            {
+                int columnX = chunkData.m_offset.x + cx * CHUNK_SIZE;
+                int columnZ = chunkData.m_offset.z + cz * CHUNK_SIZE;
+                const ColumnHeightmap& heightmap = AcquireHeightmap(columnX, columnZ);
+                for (const SurfaceFeatureAnchor& anchor : heightmap.featureAnchors)
+                {
+                    int localY = anchor.y - chunkData.m_offset.y;
+                    if (localY + reach.maxY >= 0 && localY + reach.minY < CHUNK_SIZE)
+                        anchors.push_back(anchor);
+                }
+                ReleaseHeightmap(columnX, columnZ);
+            }
+        }
+        std::sort(anchors.begin(), anchors.end(), [](const SurfaceFeatureAnchor& a, const SurfaceFeatureAnchor& b) {
+            return a.x != b.x ? a.x < b.x : a.z < b.z;
+        });
+
+        for (const SurfaceFeatureAnchor& anchor : anchors)
+        {
+            SurfaceFeature& feature = m_surfaceFeatures[anchor.feature];
+            for (int fx = 0; fx < feature.sizeX; fx++)
+            {
+                for (int fy = 0; fy < feature.sizeY; fy++)
+                {
+                    for (int fz = 0; fz < feature.sizeZ; fz++)
+                    {
+                        int blockX = anchor.x - chunkData.m_offset.x + fx + feature.offsetX;
+                        int blockY = anchor.y - chunkData.m_offset.y + fy + feature.offsetY;
+                        int blockZ = anchor.z - chunkData.m_offset.z + fz + feature.offsetZ;
+                        if (blockX < 0 || blockX >= CHUNK_SIZE || blockY < 0 || blockY >= CHUNK_SIZE || blockZ < 0 || blockZ >= CHUNK_SIZE)
+                            continue;
+
+                        int featureIndex = (fy * feature.sizeZ + fz) * feature.sizeX + fx;
+                        uint16_t block = feature.blocks[featureIndex];
+                        if (block == 0)
+                            continue;
+
+                        if (feature.replaceBlock[featureIndex] || chunkData.GetBlock(blockX, blockY, blockZ) == 0)
+                            chunkData.SetBlock(blockX, blockY, blockZ, block);
+                    }
+                }
+            }
+        }
+    }
+
+    void TerrainGen::FindSurfaceFeatureAnchors(int x, int z, const int (&surfaceBlocks)[CHUNK_SIZE][CHUNK_SIZE], std::vector<SurfaceFeatureAnchor>& anchors)
+    {
+        std::vector<float> chances(m_surfaceFeatureCount * CHUNK_SIZE * CHUNK_SIZE);
+        for (int i = 0; i < m_surfaceFeatureCount; i++)
+            Noise::GetValues2D(m_surfaceFeatures[i].noiseSettings, m_seed, x, z, CHUNK_SIZE, CHUNK_SIZE, &chances[i * CHUNK_SIZE * CHUNK_SIZE]);
+
+        for (int lx = 0; lx < CHUNK_SIZE; lx++)
+        {
+            for (int lz = 0; lz < CHUNK_SIZE; lz++)
+            {
+                int worldX = x + lx;
+                int worldZ = z + lz;
+                int surfaceBlock = surfaceBlocks[lx][lz];
+
+                // Only the first feature that passes its noise check is placed on a column,
+                // and only on a solid surface block
+                for (int i = 0; i < m_surfaceFeatureCount; i++)
+                {
+                    if (chances[(i * CHUNK_SIZE + lx) * CHUNK_SIZE + lz] < m_surfaceFeatures[i].chance)
+                        continue;
+                    if (!IsValidSurfaceFeaturePlacement(worldX, surfaceBlock, worldZ, surfaceBlock))
+                        continue;
+                    if (GetBlockInColumn(worldX, surfaceBlock, worldZ, surfaceBlock) == 0)
+                        break;
+
+                    anchors.push_back({ worldX, surfaceBlock, worldZ, i });
+                    break;
+                }
+            }
+        }
+    }
+
+    uint16_t TerrainGen::GetBlock(int x, int y, int z)
+    {
+        return GetBlockInColumn(x, y, z, GetSurfaceBlock(x, z));
+    }
+
+    uint16_t TerrainGen::GetBlockInColumn(int x, int y, int z, int surfaceBlock)
+    {
+        if (y > surfaceBlock)
+            return GetSkyBlock(x, y, z, surfaceBlock);
+        if (IsCave(x, y, z, surfaceBlock))
+            return GetCaveBlock(x, y, z, surfaceBlock);
+
+        return GetOreBlock(x, y, z, surfaceBlock, GetGroundBlock(x, y, z, surfaceBlock));
+    }
+
+    uint16_t TerrainGen::GetSkyBlock(int x, int y, int z, int surfaceBlock)
+    {
+        return 0;
+    }
+
+    uint16_t TerrainGen::GetGroundBlock(int x, int y, int z, int surfaceBlock)
+    {
+        return 1;
+    }
+
+    uint16_t TerrainGen::GetCaveBlock(int x, int y, int z, int surfaceBlock)
+    {
+        return 0;
+    }
+
+    uint16_t TerrainGen::GetOreBlock(int x, int y, int z, int surfaceBlock, uint16_t block)
+    {
+        uint16_t ore = IsOre(x, y, z, surfaceBlock);
+        return ore != 0 ? ore : block;
+    }
+
+    bool TerrainGen::IsCave(int x, int y, int z, int surfaceBlock)
+    {
+        for (int i = 0; i < m_caveNoiseLayers; i++)
+        {
+            if (Noise::GetUpsampledValue3D(m_caveNoiseSettings[i], m_seed, x, y, z) > m_caveNoiseSettings[i].m_noiseThreshold)
+                return true;
+        }
+        return false;
+    }
+
+    uint16_t TerrainGen::IsOre(int x, int y, int z, int surfaceBlock)
+    {
+        for (int i = 0; i < m_oreNoiseLayers; i++)
+        {
+            if (Noise::GetUpsampledValue3D(m_oreNoiseSettings[i], m_seed, x, y, z) > m_oreNoiseSettings[i].m_noiseThreshold)
+                return m_oreNoiseSettings[i].m_replaceBlock;
+        }
+        return 0;
+    }
+
+    int TerrainGen::GetSurfaceBlock(int x, int z)
+    {
+        return (int)std::floor(Noise::GetValueLayered2D(m_surfaceNoiseSettings, m_surfaceNoiseLayers, m_seed, x, z));
+    }
+
+    void TerrainGen::GetSurfaceBlocks(int x, int z, int (&surfaceBlocks)[CHUNK_SIZE][CHUNK_SIZE])
+    {
+        float heights[CHUNK_SIZE * CHUNK_SIZE];
+        Noise::GetValuesLayered2D(m_surfaceNoiseSettings, m_surfaceNoiseLayers, m_seed, x, z, CHUNK_SIZE, CHUNK_SIZE, heights);
+        for (int i = 0; i < CHUNK_SIZE * CHUNK_SIZE; i++)
+            surfaceBlocks[i / CHUNK_SIZE][i % CHUNK_SIZE] = (int)std::floor(heights[i]);
+    }
+
+    bool TerrainGen::IsValidSurfaceFeaturePlacement(int x, int y, int z, int surfaceBlock)
+    {
+        return !IsCave(x, y, z, surfaceBlock);
+    }
+}
@@ -0,0 +1,59 @@
+#include <WillowVox/world/World.h>
+#include <WillowVox/rendering/RenderingAPI.h>
+#include <WillowVox/rendering/engine-default/ChunkSolidMaterial.h>
+#include <WillowVox/rendering/engine-default/ChunkFluidMaterial.h>
+#include <WillowVox/rendering/engine-default/TextureMaterial.h>
+
+namespace WillowVox
+{
+    World::~World()
+    {
+        // Stops the chunk threads before the materials their chunks render with go away
+        delete m_chunkManager;
+
+        delete _solidMaterial;
+        delete _fluidMaterial;
+        delete _billboardMaterial;
+        delete _solidShader;
+        delete _fluidShader;
+        delete _billboardShader;
+        delete _tex;
+    }
+
+    void World::Start()
+    {
+        RenderingAPI* renderingAPI = RenderingAPI::m_renderingAPI;
+        _solidShader = renderingAPI->CreateShader("assets/shaders/chunk-shaders/chunk_solid_vert.glsl", "assets/shaders/chunk-shaders/chunk_solid_frag.glsl");
+        _fluidShader = renderingAPI->CreateShader("assets/shaders/chunk-shaders/chunk_fluid_vert.glsl", "assets/shaders/chunk-shaders/chunk_fluid_frag.glsl");
+        _billboardShader = renderingAPI->CreateShader("assets/shaders/chunk-shaders/chunk_billboard_vert.glsl", "assets/shaders/chunk-shaders/chunk_billboard_frag.glsl");
+        _tex = renderingAPI->CreateTexture("assets/sprites/block_map.png");
+
+        _solidMaterial = new ChunkSolidMaterial(_solidShader, _tex);
+        _fluidMaterial = new ChunkFluidMaterial(_fluidShader, _tex);
+        _billboardMaterial = new TextureMaterial(_billboardShader, _tex);
+
+        m_chunkManager->m_solidMaterial = _solidMaterial;
+        m_chunkManager->m_fluidMaterial = _fluidMaterial;
+        m_chunkManager->m_billboardMaterial = _billboardMaterial;
+        m_chunkManager->SetPlayerObj(m_mainCamera);
+        m_chunkManager->Start();
+    }
+
+    void World::Update()
+    {
+        m_chunkManager->Update();
+    }
+
+    void World::Render()
+    {
+        // Transparent chunk meshes only set their model position, so the camera is set here once
+        glm::mat4 view = m_mainCamera->GetViewMatrix();
+        glm::mat4 projection = m_mainCamera->GetProjectionMatrix();
+        _fluidMaterial->Bind();
+        _fluidMaterial->SetCameraShaderProperties(view, projection);
+        _billboardMaterial->Bind();
+        _billboardMaterial->SetCameraShaderProperties(view, projection);
+
+        m_chunkManager->Render(*m_mainCamera);
+    }
+}
@@ -0,0 +1,212 @@
+#include <WillowVox/world/WorldSave.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace WillowVox
+{
+    static void WriteU16(std::vector<uint8_t>& out, uint16_t value)
+    {
+        out.push_back((uint8_t)value);
+        out.push_back((uint8_t)(value >> 8));
+    }
+
+    static void WriteU32(std::vector<uint8_t>& out, uint32_t value)
+    {
+        WriteU16(out, (uint16_t)value);
+        WriteU16(out, (uint16_t)(value >> 16));
+    }
+
+    // Reads from a buffer, every read past the end fails and leaves ok false
+    struct Reader
+    {
+        const std::vector<uint8_t>& data;
+        std::size_t pos = 0;
+        bool ok = true;
+
+        uint16_t ReadU16()
+        {
+            if (pos + 2 > data.size())
+            {
+                ok = false;
+                return 0;
+            }
+            uint16_t value = (uint16_t)(data[pos] | data[pos + 1] << 8);
+            pos += 2;
+            return value;
+        }
+
+        uint32_t ReadU32()
+        {
+            uint32_t low = ReadU16();
+            return low | (uint32_t)ReadU16() << 16;
+        }
+    };
+
+    // Writes next to path and renames over it once the data is complete
+    static bool WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& data)
+    {
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+            file.write((const char*)data.data(), (std::streamsize)data.size());
+            if (!file)
+                return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, path, error);
+        return !error;
+    }
+
+    static bool ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& data)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            return false;
+        data.resize((std::size_t)file.tellg());
+        file.seekg(0);
+        file.read((char*)data.data(), (std::streamsize)data.size());
+        return (bool)file;
+    }
+
+    bool WorldSave::Create(int seed) const
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory / "chunks", error);
+        if (error)
+            return false;
+
+        std::vector<uint8_t> data;
+        WriteU32(data, WORLD_MAGIC);
+        WriteU32(data, VERSION);
+        WriteU32(data, (uint32_t)seed);
+        return WriteFile(m_directory / "world.dat", data);
+    }
+
+    bool WorldSave::LoadSeed(int& seed) const
+    {
+        std::vector<uint8_t> data;
+        if (!ReadFile(m_directory / "world.dat", data))
+            return false;
+
+        Reader reader{ data };
+        if (reader.ReadU32() != WORLD_MAGIC || reader.ReadU32() != VERSION)
+            return false;
+        uint32_t value = reader.ReadU32();
+        if (!reader.ok)
+            return false;
+        seed = (int)value;
+        return true;
+    }
+
+    std::filesystem::path WorldSave::GetChunkPath(const glm::ivec3& chunkPos) const
+    {
+        return m_directory / "chunks" / (std::to_string(chunkPos.x) + "_" + std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z) + ".chunk");
+    }
+
+    bool WorldSave::HasChunk(const glm::ivec3& chunkPos) const
+    {
+        std::error_code error;
+        return std::filesystem::is_regular_file(GetChunkPath(chunkPos), error);
+    }
+
+    bool WorldSave::SaveChunkData(ChunkData& chunkData) const
+    {
+        glm::ivec3 chunkPos = chunkData.m_offset / CHUNK_SIZE;
+        std::vector<uint8_t> data;
+        WriteU32(data, CHUNK_MAGIC);
+        WriteU32(data, VERSION);
+        WriteU32(data, (uint32_t)chunkPos.x);
+        WriteU32(data, (uint32_t)chunkPos.y);
+        WriteU32(data, (uint32_t)chunkPos.z);
+
+        // Run count is patched in once the runs are written
+        std::size_t runCountPos = data.size();
+        WriteU32(data, 0);
+        uint32_t runCount = 0;
+        {
+            std::shared_lock<std::shared_mutex> lock(chunkData.m_mutex);
+            if (chunkData.IsUniform())
+            {
+                WriteU16(data, chunkData.GetUniformBlock());
+                WriteU16(data, 0);  // A run of 0 is the whole chunk
+                runCount = 1;
+            }
+            else
+            {
+                uint16_t block = chunkData.GetBlockAtIndex(0);
+                int start = 0;
+                for (int i = 1; i <= CHUNK_VOLUME; i++)
+                {
+                    if (i < CHUNK_VOLUME && chunkData.GetBlockAtIndex(i) == block)
+                        continue;
+
+                    // Run lengths go up to CHUNK_VOLUME - 1, which fits in 16 bits
+                    WriteU16(data, block);
+                    WriteU16(data, (uint16_t)(i - start));
+                    runCount++;
+                    if (i < CHUNK_VOLUME)
+                    {
+                        block = chunkData.GetBlockAtIndex(i);
+                        start = i;
+                    }
+                }
+            }
+        }
+        for (int i = 0; i < 4; i++)
+            data[runCountPos + i] = (uint8_t)(runCount >> (i * 8));
+
+        return WriteFile(GetChunkPath(chunkPos), data);
+    }
+
+    bool WorldSave::LoadChunkData(ChunkData& chunkData) const
+    {
+        glm::ivec3 chunkPos = chunkData.m_offset / CHUNK_SIZE;
+        std::vector<uint8_t> data;
+        if (!ReadFile(GetChunkPath(chunkPos), data))
+            return false;
+
+        Reader reader{ data };
+        if (reader.ReadU32() != CHUNK_MAGIC || reader.ReadU32() != VERSION)
+            return false;
+        glm::ivec3 filePos;
+        filePos.x = (int)reader.ReadU32();
+        filePos.y = (int)reader.ReadU32();
+        filePos.z = (int)reader.ReadU32();
+        uint32_t runCount = reader.ReadU32();
+        if (!reader.ok || filePos != chunkPos || runCount == 0 || runCount > CHUNK_VOLUME)
+            return false;
+
+        std::vector<uint16_t> blocks(runCount);
+        std::vector<uint16_t> lengths(runCount);
+        int total = 0;
+        for (uint32_t i = 0; i < runCount; i++)
+        {
+            blocks[i] = reader.ReadU16();
+            lengths[i] = reader.ReadU16();
+            total += lengths[i] == 0 ? CHUNK_VOLUME : lengths[i];
+        }
+        if (!reader.ok || total != CHUNK_VOLUME)
+            return false;
+
+        std::unique_lock<std::shared_mutex> lock(chunkData.m_mutex);
+        chunkData.Fill(blocks[0]);
+        int index = 0;
+        for (uint32_t i = 0; i < runCount; i++)
+        {
+            int end = index + (lengths[i] == 0 ? CHUNK_VOLUME : lengths[i]);
+            if (blocks[i] != blocks[0])
+            {
+                for (int j = index; j < end; j++)
+                    chunkData.SetBlockAtIndex(j, blocks[i]);
+            }
+            index = end;
+        }
+        return true;
+    }
+}
@@ -1,14 +1,12 @@
 #version 330 core
 
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec2 aTexCoords;
-layout (location = 2) in int aDirection;
+// Packed low to high: x, y, z (6 bits each), direction (3), corner (2), atlas tile (9), see ChunkVertex
+layout (location = 0) in uint aData;
 
-out vec2 TexCoord;
+out vec2 FaceCoord;
+flat out vec2 TileCoord;
 out vec3 Normal;
 
-uniform float texMultiplier;
-
 uniform vec3 model;
 uniform mat4 view;
 uniform mat4 projection;
@@ -24,10 +22,39 @@ const vec3 normals[] = vec3[](
 	vec3( 0, -1,  0)  // 6
 );
 
+// Texture axes of each face as seen from outside, based on direction
+const vec3 faceU[] = vec3[](
+	vec3( 1,  0,  0),
+	vec3(-1,  0,  0),
+	vec3( 0,  0, -1),
+	vec3( 0,  0,  1),
+	vec3( 1,  0,  0),
+	vec3( 1,  0,  0),
+	vec3( 1,  0,  0)
+);
+const vec3 faceV[] = vec3[](
+	vec3( 0,  1,  0),
+	vec3( 0,  1,  0),
+	vec3( 0,  1,  0),
+	vec3( 0,  1,  0),
+	vec3( 0,  0, -1),
+	vec3( 0,  0,  1),
+	vec3( 0,  0,  1)
+);
+
+// Tiles are numbered in rows of ChunkVertex::ATLAS_TILES_PER_ROW
+const uint atlasTilesPerRow = 16u;
+
 void main()
 {
-    gl_Position = projection * view * vec4(aPos + model, 1.0);
-    TexCoord = aTexCoords * texMultiplier;
+    vec3 pos = vec3(aData & 63u, (aData >> 6) & 63u, (aData >> 12) & 63u);
+    int direction = int((aData >> 18) & 7u);
+    uint tile = aData >> 23;
+
+    gl_Position = projection * view * vec4(pos + model, 1.0);
+    // Merged faces span several blocks, the fragment shader repeats the tile once per block
+    FaceCoord = vec2(dot(pos, faceU[direction]), dot(pos, faceV[direction]));
+    TileCoord = vec2(tile % atlasTilesPerRow, tile / atlasTilesPerRow);
 
-    Normal = normals[aDirection];
+    Normal = normals[direction];
 }
\ No newline at end of file
@@ -0,0 +1,651 @@
+#include <StandardWorldGen.h>
+#include <StandardBlocks.h>
+#include <WillowVox/math/Noise.h>
+#include <WillowVox/world/Chunk.h>
+#include <WillowVox/world/ChunkManager.h>
+#include <WillowVox/world/ChunkMap.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+#include <WillowVox/rendering/engine-default/ChunkSolidMaterial.h>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+using namespace WillowVox;
+using namespace ScuffedMinecraft;
+
+// Every scenario runs on this seed so results compare between engine versions
+static constexpr int BENCH_SEED = 0;
+
+// Counts every heap allocation made while a scenario runs
+static std::atomic<uint64_t> allocationCount = 0;
+static std::atomic<uint64_t> allocatedBytes = 0;
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct BenchResult
+{
+    std::string name;
+    std::size_t chunks;
+    double nsPerChunk;
+    double allocationsPerChunk;
+    double allocatedBytesPerChunk;
+    // Meshing scenarios only
+    bool meshing = false;
+    double verticesPerChunk = 0;
+    double meshBytesPerChunk = 0;
+    // Chunk positions of scenarios that run on a picked subset of chunks
+    std::vector<glm::ivec3> positions;
+};
+
+// Chunk index lookups per second from reader threads while a writer streams chunks in and out
+struct ContentionResult
+{
+    std::string name;
+    int readers;
+    double lookupsPerSecond;
+    double writesPerSecond;
+};
+
+static std::vector<BenchResult> results;
+static std::vector<ContentionResult> contentionResults;
+static int runs = 5;
+static const char* filter = nullptr;
+
+// Runs generate over every chunk runs times and records the fastest run. Allocations are averaged over all runs.
+template <typename Generate>
+static void RunScenario(const std::string& name, std::vector<std::unique_ptr<ChunkData>>& chunks, Generate generate)
+{
+    if ((filter != nullptr && name.find(filter) == std::string::npos) || chunks.empty())
+        return;
+
+    // One untimed pass so first touch costs don't land on the first run
+    for (auto& chunk : chunks)
+        generate(*chunk);
+
+    double best = 1e30;
+    uint64_t allocationsBefore = allocationCount, bytesBefore = allocatedBytes;
+    for (int run = 0; run < runs; run++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (auto& chunk : chunks)
+            generate(*chunk);
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / chunks.size());
+    }
+
+    double count = (double)runs * chunks.size();
+    results.push_back({ name, chunks.size(), best, (allocationCount - allocationsBefore) / count, (allocatedBytes - bytesBefore) / count });
+}
+
+// Lists the chunks a scenario ran on in its results, for scenarios that pick a subset
+static void RecordPositions(const std::string& name, const std::vector<std::unique_ptr<ChunkData>>& chunks)
+{
+    if (results.empty() || results.back().name != name)
+        return;
+    for (auto& chunk : chunks)
+        results.back().positions.push_back(chunk->m_offset / CHUNK_SIZE);
+}
+
+// Block ids from RegisterStandardBlocks
+enum StandardBlock : uint16_t
+{
+    AIR, GRASS_BLOCK, DIRT, STONE, WATER, LOG, LEAVES, GRASS, TALL_GRASS_BOTTOM, TALL_GRASS_TOP,
+    POPPY, ORANGE_TULIP, WHITE_TULIP, PINK_TULIP, SAND
+};
+
+// Chunks around spawn, y from -4 to 3 chunks
+static std::vector<std::unique_ptr<ChunkData>> GetSpawnChunks()
+{
+    std::vector<std::unique_ptr<ChunkData>> chunks;
+    for (int x = -4; x < 4; x++)
+    {
+        for (int z = -4; z < 4; z++)
+        {
+            for (int y = -4; y < 4; y++)
+            {
+                auto chunk = std::make_unique<ChunkData>();
+                chunk->m_offset = glm::ivec3(x, y, z) * CHUNK_SIZE;
+                chunks.push_back(std::move(chunk));
+            }
+        }
+    }
+    return chunks;
+}
+
+static std::vector<std::unique_ptr<ChunkData>> GetSpawnChunks(SMTerrainGen& gen, TerrainGen::ChunkClass chunkClass)
+{
+    auto chunks = GetSpawnChunks();
+    std::erase_if(chunks, [&](auto& chunk) { return gen.ClassifyChunk(*chunk) != chunkClass; });
+    return chunks;
+}
+
+// Generates into a fresh ChunkData each time like the chunk manager, heightmaps the scenario holds stay cached
+static void GenerateFresh(SMTerrainGen& gen, ChunkData& chunk)
+{
+    ChunkData data;
+    data.m_offset = chunk.m_offset;
+    gen.GenerateChunkData(data);
+    gen.OnChunkDataUnloaded(data);
+}
+
+// Keeps the fraction of chunks that score highest, ties go to the earlier chunk
+template <typename Score>
+static void KeepHighest(std::vector<std::unique_ptr<ChunkData>>& chunks, double fraction, Score score)
+{
+    std::vector<std::pair<double, std::size_t>> scores;
+    for (std::size_t i = 0; i < chunks.size(); i++)
+        scores.push_back({ score(*chunks[i]), i });
+    std::sort(scores.begin(), scores.end(), [](auto& a, auto& b) { return a.first != b.first ? a.first > b.first : a.second < b.second; });
+
+    std::vector<std::unique_ptr<ChunkData>> kept;
+    std::size_t count = std::max<std::size_t>(1, (std::size_t)(chunks.size() * fraction));
+    for (std::size_t i = 0; i < count && i < scores.size(); i++)
+        kept.push_back(std::move(chunks[scores[i].second]));
+    std::sort(kept.begin(), kept.end(), [](auto& a, auto& b) {
+        return std::tie(a->m_offset.x, a->m_offset.z, a->m_offset.y) < std::tie(b->m_offset.x, b->m_offset.z, b->m_offset.y);
+    });
+    chunks = std::move(kept);
+}
+
+static void HoldHeightmaps(SMTerrainGen& gen, std::vector<std::unique_ptr<ChunkData>>& chunks)
+{
+    for (auto& chunk : chunks)
+        gen.AcquireHeightmap(*chunk);
+}
+
+static void ReleaseHeightmaps(SMTerrainGen& gen, std::vector<std::unique_ptr<ChunkData>>& chunks)
+{
+    for (auto& chunk : chunks)
+        gen.ReleaseHeightmap(*chunk);
+}
+
+// A chunk at a time with nothing cached, so every chunk also builds its column's heightmap
+static void BenchSingleChunk(SMTerrainGen& gen)
+{
+    auto chunks = GetSpawnChunks();
+    RunScenario("generate_chunk", chunks, [&](ChunkData& chunk) { GenerateFresh(gen, chunk); });
+}
+
+// Whole columns bottom to top, sharing one heightmap per column like streaming does
+static void BenchColumns(SMTerrainGen& gen)
+{
+    auto chunks = GetSpawnChunks();
+    std::vector<std::unique_ptr<ChunkData>> columns;
+    for (auto& chunk : chunks)
+    {
+        if (chunk->m_offset.y == -4 * CHUNK_SIZE)
+            columns.push_back(std::move(chunk));
+    }
+
+    std::size_t columnCount = columns.size();
+    RunScenario("generate_column", columns, [&](ChunkData& bottom) {
+        ChunkData column[8];
+        for (int y = 0; y < 8; y++)
+        {
+            column[y].m_offset = bottom.m_offset + glm::ivec3(0, y * CHUNK_SIZE, 0);
+            gen.GenerateChunkData(column[y]);
+        }
+        for (ChunkData& data : column)
+            gen.OnChunkDataUnloaded(data);
+    });
+
+    // Report per chunk rather than per column
+    if (!results.empty() && results.back().name == "generate_column")
+    {
+        BenchResult& result = results.back();
+        result.chunks = columnCount * 8;
+        result.nsPerChunk /= 8;
+        result.allocationsPerChunk /= 8;
+        result.allocatedBytesPerChunk /= 8;
+    }
+}
+
+// Only the feature pass, over mixed chunks that already hold their terrain
+static void BenchSurfaceFeatures(SMTerrainGen& gen)
+{
+    auto chunks = GetSpawnChunks(gen, TerrainGen::MIXED);
+    HoldHeightmaps(gen, chunks);
+    for (auto& chunk : chunks)
+        gen.GenerateChunkBlocks(*chunk);
+
+    // Features write the same blocks every time, so the chunks can be reused between runs
+    RunScenario("surface_features", chunks, [&](ChunkData& chunk) { gen.GenerateSurfaceFeatures(chunk); });
+    ReleaseHeightmaps(gen, chunks);
+}
+
+// The underground chunks with the most cave air
+static void BenchCaves(SMTerrainGen& gen)
+{
+    auto chunks = GetSpawnChunks(gen, TerrainGen::UNDERGROUND);
+    KeepHighest(chunks, 0.25, [&](ChunkData& chunk) {
+        ChunkData data;
+        data.m_offset = chunk.m_offset;
+        gen.GenerateChunkData(data);
+        gen.OnChunkDataUnloaded(data);
+        int air = 0;
+        for (int i = 0; i < CHUNK_VOLUME; i++)
+            air += data.GetBlockAtIndex(i) == 0;
+        return (double)air;
+    });
+
+    HoldHeightmaps(gen, chunks);
+    RunScenario("underground_caves", chunks, [&](ChunkData& chunk) { GenerateFresh(gen, chunk); });
+    RecordPositions("underground_caves", chunks);
+    ReleaseHeightmaps(gen, chunks);
+}
+
+// The mixed chunks with the most cave air below the surface plus logs, leaves and plants, so the
+// surface, cave and feature passes all have work. Picked by content rather than timing so every
+// run and machine times the same chunks.
+static void BenchWorstMixed(SMTerrainGen& gen)
+{
+    auto chunks = GetSpawnChunks(gen, TerrainGen::MIXED);
+    KeepHighest(chunks, 0.25, [&](ChunkData& chunk) {
+        const TerrainGen::ColumnHeightmap& heightmap = gen.AcquireHeightmap(chunk);
+        ChunkData data;
+        data.m_offset = chunk.m_offset;
+        gen.GenerateChunkData(data);
+        gen.OnChunkDataUnloaded(data);
+        int score = 0;
+        for (int i = 0; i < CHUNK_VOLUME; i++)
+        {
+            int x = i / (CHUNK_SIZE * CHUNK_SIZE), y = i / CHUNK_SIZE % CHUNK_SIZE, z = i % CHUNK_SIZE;
+            uint16_t block = data.GetBlockAtIndex(i);
+            bool caveAir = block == AIR && data.m_offset.y + y <= heightmap.surfaceBlocks[x][z];
+            bool feature = block >= LOG && block <= PINK_TULIP;
+            score += caveAir || feature;
+        }
+        gen.ReleaseHeightmap(chunk);
+        return (double)score;
+    });
+
+    HoldHeightmaps(gen, chunks);
+    RunScenario("mixed_worst", chunks, [&](ChunkData& chunk) { GenerateFresh(gen, chunk); });
+    RecordPositions("mixed_worst", chunks);
+    ReleaseHeightmaps(gen, chunks);
+}
+
+// Virtual TerrainGen block picking against SMTerrainGen's inlined TerrainGenT path on the same chunks
+static void BenchBlockPicking(SMTerrainGen& gen, TerrainGen::ChunkClass chunkClass, const char* name)
+{
+    auto chunks = GetSpawnChunks(gen, chunkClass);
+
+    // Heightmaps held so only the voxel loop is timed
+    HoldHeightmaps(gen, chunks);
+    RunScenario(std::string("blocks_virtual_") + name, chunks, [&](ChunkData& chunk) { gen.TerrainGen::GenerateChunkBlocks(chunk); });
+    RunScenario(std::string("blocks_inline_") + name, chunks, [&](ChunkData& chunk) { gen.GenerateChunkBlocks(chunk); });
+    ReleaseHeightmaps(gen, chunks);
+}
+
+// A chunk filled from pattern(x, y, z)
+template <typename Pattern>
+static std::unique_ptr<ChunkData> MakeChunk(Pattern pattern)
+{
+    auto chunk = std::make_unique<ChunkData>();
+    for (int x = 0; x < CHUNK_SIZE; x++)
+        for (int y = 0; y < CHUNK_SIZE; y++)
+            for (int z = 0; z < CHUNK_SIZE; z++)
+                chunk->SetBlock(x, y, z, pattern(x, y, z));
+    chunk->Compact();
+    return chunk;
+}
+
+// Deterministic per voxel noise for the synthetic patterns
+static uint32_t HashVoxel(int x, int y, int z)
+{
+    uint32_t hash = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^ (uint32_t)z * 83492791u;
+    hash ^= hash >> 13;
+    hash *= 0x5bd1e995u;
+    return hash ^ hash >> 15;
+}
+
+// Meshes copies of a chunk surrounded by air and uploads them to the null backend
+template <typename Pattern>
+static void BenchMeshing(const char* name, ChunkManager& chunkManager, BaseMaterial& material, Pattern pattern)
+{
+    std::vector<std::unique_ptr<ChunkData>> chunks;
+    for (int i = 0; i < 16; i++)
+        chunks.push_back(MakeChunk(pattern));
+
+    std::size_t vertices = 0, meshBytes = 0;
+    RunScenario(std::string("mesh_") + name, chunks, [&](ChunkData& chunkData) {
+        Chunk chunk(chunkManager, &material, &material, &material, glm::ivec3(0), glm::vec3(0));
+        chunk.m_chunkData = &chunkData;
+        chunk.GenerateChunkMeshData();
+        vertices = chunk.GetMeshVertexCount();
+        meshBytes = chunk.GetMeshDataSize();
+        chunk.GenerateChunkMesh();
+    });
+
+    if (!results.empty() && results.back().name == std::string("mesh_") + name)
+    {
+        results.back().meshing = true;
+        results.back().verticesPerChunk = (double)vertices;
+        results.back().meshBytesPerChunk = (double)meshBytes;
+    }
+}
+
+static void BenchAllMeshing()
+{
+    RegisterStandardBlocks();
+    // Only the upload totals are wanted, not a log entry per upload
+    NullAPI nullAPI;
+    nullAPI.m_recording = false;
+    RenderingAPI::m_renderingAPI = &nullAPI;
+    Shader* shader = nullAPI.CreateShader("", "");
+    Texture* texture = nullAPI.CreateTexture("");
+    ChunkSolidMaterial material(shader, texture);
+
+    // Chunks only reach the manager for edits, it's never started
+    WorldGen worldGen(BENCH_SEED);
+    ChunkManager chunkManager(worldGen);
+
+    // Every other block solid, nothing can merge and every face is visible
+    BenchMeshing("checkerboard", chunkManager, material, [](int x, int y, int z) {
+        return (uint16_t)((x + y + z) & 1 ? STONE : AIR);
+    });
+    BenchMeshing("solid", chunkManager, material, [](int x, int y, int z) {
+        return (uint16_t)STONE;
+    });
+    // Rolling hills of grass over dirt and stone
+    BenchMeshing("surface", chunkManager, material, [](int x, int y, int z) {
+        int height = 16 + (int)std::lround(6 * std::sin(x * 0.3) * std::cos(z * 0.25));
+        if (y >= height)
+            return (uint16_t)AIR;
+        return (uint16_t)(y == height - 1 ? GRASS_BLOCK : (y >= height - 4 ? DIRT : STONE));
+    });
+    // Stone with a connected network of round tunnels
+    BenchMeshing("caves", chunkManager, material, [](int x, int y, int z) {
+        double field = std::cos(x * 0.45) * std::cos(y * 0.45) * std::cos(z * 0.45);
+        return (uint16_t)(field > 0.15 ? AIR : STONE);
+    });
+    // A meadow under a leaf canopy: every column holds a plant, trunks hold up leaves with gaps
+    BenchMeshing("foliage", chunkManager, material, [](int x, int y, int z) {
+        uint32_t column = HashVoxel(x, 0, z);
+        bool trunk = column % 37 == 0;
+        if (y == 0)
+            return (uint16_t)GRASS_BLOCK;
+        if (y >= 24 && y < 28)
+            return (uint16_t)(trunk ? LOG : (HashVoxel(x, y, z) % 4 != 0 ? LEAVES : AIR));
+        if (trunk)
+            return (uint16_t)(y < 24 ? LOG : AIR);
+        static const uint16_t PLANTS[] = { GRASS, GRASS, TALL_GRASS_BOTTOM, POPPY, ORANGE_TULIP, WHITE_TULIP, PINK_TULIP };
+        uint16_t plant = PLANTS[column / 37 % 7];
+        if (y == 1)
+            return plant;
+        if (y == 2 && plant == TALL_GRASS_BOTTOM)
+            return (uint16_t)TALL_GRASS_TOP;
+        return (uint16_t)AIR;
+    });
+    // A lake over a sand floor, with stone pillars breaking the surface
+    BenchMeshing("water", chunkManager, material, [](int x, int y, int z) {
+        bool pillar = HashVoxel(x, 0, z) % 16 == 0;
+        if (y < 4)
+            return (uint16_t)SAND;
+        if (pillar && y < 28)
+            return (uint16_t)STONE;
+        return (uint16_t)(y < 24 ? WATER : AIR);
+    });
+
+    RenderingAPI::m_renderingAPI = nullptr;
+    delete shader;
+    delete texture;
+}
+
+// The chunk index before ChunkMap: one mutex around an unordered_map
+class LockedChunkMap
+{
+public:
+    int Find(const glm::ivec3& pos, int notFound)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _map.find(pos);
+        return it != _map.end() ? it->second : notFound;
+    }
+
+    void Insert(const glm::ivec3& pos, int value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _map[pos] = value;
+    }
+
+    bool Erase(const glm::ivec3& pos)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _map.erase(pos) > 0;
+    }
+
+    void Synchronize() {}
+
+private:
+    std::unordered_map<glm::ivec3, int, ivec3Hash> _map;
+    std::mutex _mutex;
+};
+
+// A player flying along x through a box of the default render distance, as fast as the writer can
+// stream slabs of chunks in front and out behind. Readers look up random chunks around the player.
+template <typename Map>
+static void BenchContention(const char* mapName, int readerCount)
+{
+    std::string name = std::string("contention_") + mapName + "_r" + std::to_string(readerCount);
+    if (filter != nullptr && name.find(filter) == std::string::npos)
+        return;
+
+    const int distance = 10, height = 2;
+    const int slabSize = (2 * distance + 1) * (2 * height + 1);
+    Map map;
+    auto insertSlab = [&](int x) {
+        for (int y = -height; y <= height; y++)
+            for (int z = -distance; z <= distance; z++)
+                map.Insert({ x, y, z }, x);
+    };
+    auto eraseSlab = [&](int x) {
+        for (int y = -height; y <= height; y++)
+            for (int z = -distance; z <= distance; z++)
+                map.Erase({ x, y, z });
+    };
+    for (int x = -distance; x <= distance; x++)
+        insertSlab(x);
+
+    std::atomic<int> playerX = 0;
+    std::atomic<bool> stop = false;
+    std::atomic<uint64_t> lookups = 0, hits = 0;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < readerCount; i++)
+    {
+        readers.emplace_back([&, i]() {
+            uint32_t random = HashVoxel(i, 0, 0);
+            uint64_t readerLookups = 0, readerHits = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                int x = playerX.load(std::memory_order_relaxed);
+                for (int j = 0; j < 256; j++)
+                {
+                    random = random * 1664525u + 1013904223u;
+                    glm::ivec3 pos(x + (int)(random >> 8 & 31) % (2 * distance + 1) - distance,
+                        (int)(random >> 13 & 7) % (2 * height + 1) - height,
+                        (int)(random >> 16 & 31) % (2 * distance + 1) - distance);
+                    if (map.Find(pos, -1) != -1)
+                        readerHits++;
+                }
+                readerLookups += 256;
+            }
+            lookups += readerLookups;
+            hits += readerHits;
+        });
+    }
+
+    uint64_t writes = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    for (int x = 1; elapsed < 0.25; x++)
+    {
+        insertSlab(x + distance);
+        eraseSlab(x - distance - 1);
+        map.Synchronize();
+        playerX.store(x, std::memory_order_relaxed);
+        writes += 2 * slabSize;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    contentionResults.push_back({ name, readerCount, lookups / elapsed, writes / elapsed });
+}
+
+static void BenchAllContention()
+{
+    int maxReaders = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+    for (int readers = 1; readers <= 8; readers *= 2)
+    {
+        if (readers > maxReaders && readers > 1)
+            break;
+        BenchContention<LockedChunkMap>("mutex", readers);
+        BenchContention<ChunkMap<int>>("chunkmap", readers);
+    }
+}
+
+static void PrintTable()
+{
+    bool anyMeshing = std::any_of(results.begin(), results.end(), [](const BenchResult& result) { return result.meshing; });
+    bool anyGeneration = std::any_of(results.begin(), results.end(), [](const BenchResult& result) { return !result.meshing; });
+
+    if (anyGeneration)
+        printf("%-28s %7s %12s %10s %12s %12s %12s\n", "scenario", "chunks", "us/chunk", "ns/voxel", "chunks/s", "allocs/chunk", "KB/chunk");
+    for (const BenchResult& result : results)
+    {
+        if (result.meshing)
+            continue;
+        printf("%-28s %7zu %12.1f %10.2f %12.1f %12.1f %12.1f\n", result.name.c_str(), result.chunks, result.nsPerChunk / 1000.0,
+            result.nsPerChunk / CHUNK_VOLUME, 1e9 / result.nsPerChunk, result.allocationsPerChunk, result.allocatedBytesPerChunk / 1024.0);
+    }
+
+    if (anyMeshing)
+        printf("%s%-28s %7s %12s %12s %12s %12s %12s\n", anyGeneration ? "\n" : "", "scenario", "chunks", "us/chunk", "verts/chunk", "Mverts/s", "KB emitted", "allocs/chunk");
+    for (const BenchResult& result : results)
+    {
+        if (!result.meshing)
+            continue;
+        printf("%-28s %7zu %12.1f %12.0f %12.2f %12.1f %12.1f\n", result.name.c_str(), result.chunks, result.nsPerChunk / 1000.0,
+            result.verticesPerChunk, result.verticesPerChunk / result.nsPerChunk * 1000.0, result.meshBytesPerChunk / 1024.0, result.allocationsPerChunk);
+    }
+
+    if (!contentionResults.empty())
+        printf("%s%-28s %7s %12s %12s %12s\n", results.empty() ? "" : "\n", "scenario", "readers", "Mlookups/s", "per reader", "Mwrites/s");
+    for (const ContentionResult& result : contentionResults)
+    {
+        printf("%-28s %7d %12.2f %12.2f %12.3f\n", result.name.c_str(), result.readers, result.lookupsPerSecond / 1e6,
+            result.lookupsPerSecond / result.readers / 1e6, result.writesPerSecond / 1e6);
+    }
+}
+
+static void PrintJson()
+{
+    printf("{\n  \"seed\": %d,\n  \"simd\": \"%s\",\n  \"runs\": %d,\n  \"scenarios\": [\n",
+        BENCH_SEED, Noise::GetSimdLevelName(Noise::GetSimdLevel()), runs);
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        const BenchResult& result = results[i];
+        printf("    { \"name\": \"%s\", \"chunks\": %zu, \"ns_per_chunk\": %.1f, \"ns_per_voxel\": %.4f, \"chunks_per_second\": %.2f, "
+            "\"allocations_per_chunk\": %.2f, \"allocated_bytes_per_chunk\": %.1f",
+            result.name.c_str(), result.chunks, result.nsPerChunk, result.nsPerChunk / CHUNK_VOLUME, 1e9 / result.nsPerChunk,
+            result.allocationsPerChunk, result.allocatedBytesPerChunk);
+        if (result.meshing)
+        {
+            printf(", \"vertices_per_chunk\": %.0f, \"vertices_per_second\": %.0f, \"mesh_bytes_per_chunk\": %.0f",
+                result.verticesPerChunk, result.verticesPerChunk / result.nsPerChunk * 1e9, result.meshBytesPerChunk);
+        }
+        if (!result.positions.empty())
+        {
+            printf(", \"chunk_positions\": [");
+            for (std::size_t j = 0; j < result.positions.size(); j++)
+            {
+                const glm::ivec3& pos = result.positions[j];
+                printf("%s[%d, %d, %d]", j > 0 ? ", " : "", pos.x, pos.y, pos.z);
+            }
+            printf("]");
+        }
+        printf(" }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    printf("  ],\n  \"contention\": [\n");
+    for (std::size_t i = 0; i < contentionResults.size(); i++)
+    {
+        const ContentionResult& result = contentionResults[i];
+        printf("    { \"name\": \"%s\", \"readers\": %d, \"lookups_per_second\": %.0f, \"writes_per_second\": %.0f }%s\n",
+            result.name.c_str(), result.readers, result.lookupsPerSecond, result.writesPerSecond, i + 1 < contentionResults.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+            runs = std::max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else
+        {
+            printf("Usage: willowvox_bench [--json] [--runs N] [--filter NAME]\n");
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    Noise::InitNoise();
+    if (!json)
+        printf("Noise SIMD level: %s, seed %d, best of %d runs\n", Noise::GetSimdLevelName(Noise::GetSimdLevel()), BENCH_SEED, runs);
+
+    StandardWorldGen standardWorldGen(BENCH_SEED);
+    SMTerrainGen& gen = *standardWorldGen.m_worldGen;
+    BenchSingleChunk(gen);
+    BenchColumns(gen);
+    BenchSurfaceFeatures(gen);
+    BenchCaves(gen);
+    BenchWorstMixed(gen);
+    BenchBlockPicking(gen, TerrainGen::SKY, "sky");
+    BenchBlockPicking(gen, TerrainGen::MIXED, "mixed");
+    BenchBlockPicking(gen, TerrainGen::UNDERGROUND, "underground");
+    BenchAllMeshing();
+    BenchAllContention();
+
+    if (json)
+        PrintJson();
+    else
+        PrintTable();
+    return 0;
+}
@@ -1,10 +1,13 @@
-#include <WillowVox/world/TerrainGen.h>
+#pragma once
+
+#include <WillowVox/world/TerrainGenT.h>
 
 using namespace WillowVox;
 
 namespace ScuffedMinecraft
 {
-	class SMTerrainGen : public TerrainGen
+	// Built on TerrainGenT so its block picking functions inline into chunk generation
+	class SMTerrainGen final : public TerrainGenT<SMTerrainGen>
 	{
 	public:
 		SMTerrainGen(int seed, NoiseSettings2D* surfaceNoiseSettings, int surfaceNoiseLayers, CaveNoiseSettings* caveNoiseSettings,
@@ -12,7 +15,7 @@ namespace ScuffedMinecraft
 			SurfaceFeature* surfaceFeatures, int surfaceFeatureCount,
 			int waterLevel, int dirtLayers, int sandLayers)
 
-			: TerrainGen(seed, surfaceNoiseSettings, surfaceNoiseLayers, caveNoiseSettings, caveNoiseLayers,
+			: TerrainGenT(seed, surfaceNoiseSettings, surfaceNoiseLayers, caveNoiseSettings, caveNoiseLayers,
 				oreNoiseSettings, oreNoiseLayers, surfaceFeatures, surfaceFeatureCount),
 			  m_waterLevel(waterLevel), m_dirtLayers(dirtLayers), m_sandLayers(sandLayers) {}
 
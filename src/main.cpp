@@ -12,7 +12,9 @@
 #include <WillowVox/rendering/engine-default/TextureMaterial.h>
 #include <WillowVox/physics/Physics.h>
 #include <WillowVox/resources/Blocks.h>
+#include <WillowVox/world/ChunkPool.h>
 #include <StandardWorld.h>
+#include <StandardBlocks.h>
 #include <BlockOutlineMaterial.h>
 #include <BlockOutlineVertex.h>
 #include <CrosshairMaterial.h>
@@ -47,20 +49,7 @@ namespace ScuffedMinecraft
 
 		void RegisterBlocks() override
 		{
-			Blocks::RegisterBlock({ 1, 1, 0, 0, 1, 0, Block::SOLID, "Grass Block" });
-			Blocks::RegisterBlock({ 0, 0, Block::SOLID, "Dirt Block" });
-			Blocks::RegisterBlock({ 0, 1, Block::SOLID, "Stone Block" });
-			Blocks::RegisterBlock({ 0, 4, Block::LIQUID, "Water" });
-			Blocks::RegisterBlock({ 2, 1, 2, 1, 2, 0, Block::SOLID, "Log" });
-			Blocks::RegisterBlock({ 0, 2, Block::LEAVES, "Leaves" });
-			Blocks::RegisterBlock({ 1, 2, Block::BILLBOARD, "Grass" });
-			Blocks::RegisterBlock({ 3, 0, Block::BILLBOARD, "Tall Grass Bottom" });
-			Blocks::RegisterBlock({ 3, 1, Block::BILLBOARD, "Tall Grass Top" });
-			Blocks::RegisterBlock({ 0, 3, Block::BILLBOARD, "Poppy" });
-			Blocks::RegisterBlock({ 1, 3, Block::BILLBOARD, "Orange Tulip" });
-			Blocks::RegisterBlock({ 2, 2, Block::BILLBOARD, "White Tulip" });
-			Blocks::RegisterBlock({ 3, 2, Block::BILLBOARD, "Pink Tulip" });
-			Blocks::RegisterBlock({ 4, 0, Block::SOLID, "Sand" });
+			RegisterStandardBlocks();
 		}
 
 		void Start() override
@@ -311,10 +300,24 @@ namespace ScuffedMinecraft
 				m_world->m_chunkManager->ClearChunkQueue();
 			if (ImGui::SliderInt("Render Height", &m_world->m_chunkManager->m_renderHeight, 0, 10))
 				m_world->m_chunkManager->ClearChunkQueue();
+			ImGui::Text("Chunks/s: %.1f generated, %.1f meshed", m_world->m_chunkManager->GetGeneratedChunksPerSecond(), m_world->m_chunkManager->GetMeshedChunksPerSecond());
 			ImGui::Checkbox("Use absolute Y axis for camera vertical movement", &_absoluteYMovement);
 			if (ImGui::Checkbox("Vsync", &_vsync))
 				_renderingAPI->SetVsync(_vsync);
 			ImGui::Text("Selected Block: %s", Blocks::blocks[_selectedBlock].blockName);
+			if (ImGui::CollapsingHeader("Chunk Pools"))
+			{
+				int memoryLimit = (int)(ChunkPools::GetMemoryLimit() / (1024 * 1024));
+				if (ImGui::SliderInt("Pool Limit (MB)", &memoryLimit, 64, 4096))
+					ChunkPools::SetMemoryLimit((std::size_t)memoryLimit * 1024 * 1024);
+				ImGui::Text("Slabs: %.1f MB", ChunkPools::GetSlabMemory() / (1024.0f * 1024.0f));
+				for (const SlabPool::Stats& stats : ChunkPools::GetStats())
+				{
+					if (stats.highWater == 0)
+						continue;
+					ImGui::Text("%s: %zu live, %zu free, %zu high-water, %zu overflow", stats.name, stats.live, stats.free, stats.highWater, stats.overflow);
+				}
+			}
 			ImGui::End();
 
 			_renderingAPI->SetCullFace(false);
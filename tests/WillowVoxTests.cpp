@@ -0,0 +1,542 @@
+#include <StandardWorldGen.h>
+#include <StandardBlocks.h>
+#include <WillowVox/math/Noise.h>
+#include <WillowVox/world/Chunk.h>
+#include <WillowVox/world/ChunkData.h>
+#include <WillowVox/world/ChunkGrid.h>
+#include <WillowVox/world/ChunkManager.h>
+#include <WillowVox/world/WorldSave.h>
+#include <WillowVox/rendering/null/NullAPI.h>
+#include <WillowVox/rendering/engine-default/ChunkSolidMaterial.h>
+#include <WillowVox/rendering/engine-default/ChunkVertex.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace WillowVox;
+using namespace ScuffedMinecraft;
+
+// Tests use the same seed as the benchmarks
+static constexpr int TEST_SEED = 0;
+
+// Block ids from RegisterStandardBlocks
+enum StandardBlock : uint16_t
+{
+    AIR, GRASS_BLOCK, DIRT, STONE
+};
+
+// Reports a failed check and makes the test fail, the test keeps running
+static bool failed = false;
+
+static void Check(bool condition, const char* what)
+{
+    if (condition)
+        return;
+    std::printf("    check failed: %s\n", what);
+    failed = true;
+}
+
+static void CheckEqual(uint64_t actual, uint64_t expected, const char* what)
+{
+    if (actual == expected)
+        return;
+    std::printf("    check failed: %s, got %llu, expected %llu\n", what, (unsigned long long)actual, (unsigned long long)expected);
+    failed = true;
+}
+
+// An edit meshes only the section it's in, with the chunk manager's default settings,
+// and the spliced mesh matches meshing the edited chunk from scratch
+static void TestSectionRemesh()
+{
+    RegisterStandardBlocks();
+    NullAPI nullAPI;
+    nullAPI.m_recording = false;
+    RenderingAPI::m_renderingAPI = &nullAPI;
+    Shader* shader = nullAPI.CreateShader("", "");
+    Texture* texture = nullAPI.CreateTexture("");
+    ChunkSolidMaterial material(shader, texture);
+
+    // Chunks only reach the manager for edits, it's never started
+    WorldGen worldGen(TEST_SEED);
+    ChunkManager chunkManager(worldGen);
+
+    // Stone under a grass surface that steps up across the chunk, so every section has faces
+    ChunkData chunkData;
+    for (int x = 0; x < CHUNK_SIZE; x++)
+        for (int y = 0; y < CHUNK_SIZE; y++)
+            for (int z = 0; z < CHUNK_SIZE; z++)
+            {
+                int height = 4 + x * 3 / 4;
+                chunkData.SetBlock(x, y, z, y < height - 1 ? STONE : (y == height - 1 ? GRASS_BLOCK : AIR));
+            }
+
+    Chunk chunk(chunkManager, &material, &material, &material, glm::ivec3(0), glm::vec3(0));
+    chunk.m_chunkData = &chunkData;
+    chunk.GenerateChunkMeshData();
+    chunk.GenerateChunkMesh();
+    CheckEqual(chunk.GetLastRemeshedSections(), (1u << Chunk::SECTION_COUNT) - 1, "first mesh builds every section");
+
+    // Layers 11 to 13 are dirtied, all in section 1
+    Chunk::BlockEdit edit = { (uint16_t)(4 * CHUNK_SIZE * CHUNK_SIZE + 12 * CHUNK_SIZE + 4), STONE };
+    chunk.ApplyEdits(&edit, 1);
+    nullAPI.m_uploadedVertices = 0;
+    chunk.ReloadDirtySections();
+    CheckEqual(chunk.GetLastRemeshedSections(), 1u << 1, "edit remeshes only its section");
+    const uint64_t partialVertices = nullAPI.m_uploadedVertices;
+
+    Chunk fresh(chunkManager, &material, &material, &material, glm::ivec3(0), glm::vec3(0));
+    fresh.m_chunkData = &chunkData;
+    fresh.GenerateChunkMeshData();
+    nullAPI.m_uploadedVertices = 0;
+    fresh.GenerateChunkMesh();
+    CheckEqual(partialVertices, nullAPI.m_uploadedVertices, "partial remesh uploads the same vertices as a full mesh");
+    Check(partialVertices > 0, "edited chunk has a mesh");
+
+    // Two edits in different sections remesh both and nothing else
+    Chunk::BlockEdit edits[2] = {
+        { (uint16_t)(20 * CHUNK_SIZE * CHUNK_SIZE + 2 * CHUNK_SIZE + 4), AIR },
+        { (uint16_t)(20 * CHUNK_SIZE * CHUNK_SIZE + 28 * CHUNK_SIZE + 4), STONE }
+    };
+    chunk.ApplyEdits(edits, 2);
+    chunk.ReloadDirtySections();
+    CheckEqual(chunk.GetLastRemeshedSections(), 1u << 0 | 1u << 3, "edits remesh only their sections");
+
+    RenderingAPI::m_renderingAPI = nullptr;
+}
+
+static_assert(sizeof(ChunkVertex) == 4, "ChunkVertex must stay one 32-bit word");
+
+// Every field of a packed ChunkVertex unpacks to what went in, at the edges of its range.
+// Coordinates reach CHUNK_SIZE since a face can sit on the far side of the last block.
+static void TestChunkVertexPacking()
+{
+    const int coordinates[] = { 0, 1, CHUNK_SIZE / 2, CHUNK_SIZE - 1, CHUNK_SIZE };
+    const int tiles[] = { 0, 1, 255, 256, 510, 511 };
+    std::size_t mismatches = 0;
+    for (int x : coordinates)
+        for (int y : coordinates)
+            for (int z : coordinates)
+                for (int direction = 0; direction < 6; direction++)
+                    for (int corner = 0; corner < 4; corner++)
+                        for (int tile : tiles)
+                        {
+                            uint32_t data = ChunkVertex(x, y, z, direction, corner, tile).m_data;
+                            bool matches = ChunkVertex::GetX(data) == x && ChunkVertex::GetY(data) == y && ChunkVertex::GetZ(data) == z
+                                && ChunkVertex::GetDirection(data) == direction && ChunkVertex::GetCorner(data) == corner
+                                && ChunkVertex::GetTile(data) == tile;
+                            if (!matches && mismatches++ == 0)
+                                std::printf("    %d %d %d direction %d corner %d tile %d packs to %08x\n", x, y, z, direction, corner, tile, data);
+                        }
+    CheckEqual(mismatches, 0, "vertices that don't round trip");
+
+    // Every field at its maximum sets all 32 bits, so none overlap or fall off the top
+    CheckEqual(ChunkVertex::Pack(63, 63, 63, 7, 3, 511), 0xffffffffu, "all fields at their maximum");
+    CheckEqual(ChunkVertex::GetTile(ChunkVertex::Pack(0, 0, 0, 0, 0, ChunkVertex::GetTileIndex(4, 1))), 20, "tile index of (4, 1)");
+    CheckEqual(ChunkVertex::GetTile(ChunkVertex::Pack(0, 0, 0, 0, 0, ChunkVertex::GetTileIndex(15, 31))), 511, "last tile index");
+}
+
+struct GridEntry
+{
+    glm::ivec3 pos;
+};
+
+struct GridEntryPos
+{
+    glm::ivec3 operator()(const GridEntry& entry) const { return entry.pos; }
+};
+
+// Resizing a grid refills it around its center from the map behind it, and moving only
+// refills the positions that came into the box
+static void TestChunkGridResize()
+{
+    std::vector<GridEntry> entries;
+    for (int x = -6; x <= 6; x++)
+        for (int y = -3; y <= 3; y++)
+            for (int z = -6; z <= 6; z++)
+                entries.push_back({ { x, y, z } });
+    auto find = [&](const glm::ivec3& pos) -> GridEntry* {
+        for (GridEntry& entry : entries)
+            if (entry.pos == pos)
+                return &entry;
+        return nullptr;
+    };
+
+    ChunkGrid<GridEntry, GridEntryPos> grid;
+    Check(grid.Find({ 0, 0, 0 }) == nullptr, "empty grid finds nothing");
+
+    grid.Resize({ 2, 1, 2 });
+    grid.SetCenter({ 0, 0, 0 }, find);
+    Check(grid.Find({ 2, 1, -2 }) == find({ 2, 1, -2 }), "corner of the box");
+    Check(grid.Find({ 3, 0, 0 }) == nullptr, "outside the box");
+
+    // Same center, bigger box, the grid has to refill instead of skipping an unchanged center
+    grid.Resize({ 4, 2, 4 });
+    grid.FreeRetired();
+    CheckEqual(grid.GetHalfExtent().x, 4, "new half extent");
+    grid.SetCenter({ 0, 0, 0 }, find);
+    std::size_t missing = 0;
+    for (int x = -4; x <= 4; x++)
+        for (int y = -2; y <= 2; y++)
+            for (int z = -4; z <= 4; z++)
+                missing += grid.Find({ x, y, z }) != find({ x, y, z });
+    CheckEqual(missing, 0, "positions missing after growing");
+
+    grid.SetCenter({ 2, 1, 0 }, find);
+    Check(grid.Find({ 6, 3, 4 }) == find({ 6, 3, 4 }), "position that came into the box");
+
+    grid.Resize({ 1, 1, 1 });
+    grid.FreeRetired();
+    grid.SetCenter({ 2, 1, 0 }, find);
+    Check(grid.Find({ 3, 2, 1 }) == find({ 3, 2, 1 }), "corner after shrinking");
+    Check(grid.Find({ 4, 1, 0 }) == nullptr, "outside after shrinking");
+}
+
+// Number of samples in a batch that aren't bit for bit what sample(i) returns
+template <typename Sample>
+static std::size_t CountMismatches(const std::vector<float>& batch, Sample sample)
+{
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        float expected = sample(i);
+        mismatches += std::memcmp(&batch[i], &expected, sizeof(float)) != 0;
+    }
+    return mismatches;
+}
+
+// Every batch function gives exactly the single sample values at every SIMD level, so
+// compiler flags that contract or reorder float math in one path can't slip through
+static void TestNoiseSimdMatchesScalar()
+{
+    Noise::InitNoise();
+    const Noise::SimdLevel bestLevel = Noise::GetSimdLevel();
+
+    NoiseSettings2D surface[] = { { 20.0f, 0.5f, 1, 0, 0, -5 }, { 3.0f, 2.4f, 3, 0.5f, 2.0f, 0, 11.5f, -4.25f } };
+    NoiseSettings3D noise3D(1.0f, 4.0f, 3, 0.5f, 2.0f, 0.3f, -1.7f, 2.1f);
+    CaveNoiseSettings cave(2.5f, 2, 0.5f, 2.0f, 0.5f, 0, 0, 0, 4);
+    OreNoiseSettings ore(4.5f, 1, 0, 0, 0.7f, 2, 14.0f, 34.0f, 23.0f, 3);
+
+    // Sizes that aren't a multiple of any vector width, so the remainder lanes are covered too
+    const int sizeX = 5, sizeY = 7, sizeZ = 13;
+    const struct { float x, y, z, step; } grids[] = {
+        { 0, 0, 0, 1.0f }, { 37.0f, -12.0f, 5.0f, 1.0f }, { -70.5f, -33.25f, -101.75f, 0.5f }, { 1000.0f, -250.0f, 3.0f, 3.0f }
+    };
+    const glm::ivec3 upsampledOrigins[] = { { 0, 0, 0 }, { -37, -13, 6 }, { 95, -64, -1 } };
+
+    const Noise::SimdLevel levels[] = { Noise::SCALAR, Noise::SSE41, Noise::AVX2 };
+    for (Noise::SimdLevel level : levels)
+    {
+        Noise::SetSimdLevel(level);
+        if (Noise::GetSimdLevel() != level)
+        {
+            std::printf("    %s not supported, skipped\n", Noise::GetSimdLevelName(level));
+            continue;
+        }
+
+        std::size_t mismatches = 0;
+        for (const auto& grid : grids)
+        {
+            auto x = [&](std::size_t i, int size) { return grid.x + (int)(i / size) * grid.step; };
+            auto y2D = [&](std::size_t i) { return grid.y + (int)(i % sizeY) * grid.step; };
+            std::vector<float> values(sizeX * sizeY);
+            for (NoiseSettings2D& settings : surface)
+            {
+                Noise::GetValues2D(settings, TEST_SEED, grid.x, grid.y, sizeX, sizeY, values.data(), grid.step);
+                mismatches += CountMismatches(values, [&](std::size_t i) { return Noise::GetValue2D(settings, TEST_SEED, x(i, sizeY), y2D(i)); });
+            }
+            Noise::GetValuesLayered2D(surface, 2, TEST_SEED, grid.x, grid.y, sizeX, sizeY, values.data(), grid.step);
+            mismatches += CountMismatches(values, [&](std::size_t i) { return Noise::GetValueLayered2D(surface, 2, TEST_SEED, x(i, sizeY), y2D(i)); });
+
+            auto y3D = [&](std::size_t i) { return grid.y + (int)(i / sizeZ % sizeY) * grid.step; };
+            auto z3D = [&](std::size_t i) { return grid.z + (int)(i % sizeZ) * grid.step; };
+            values.resize(sizeX * sizeY * sizeZ);
+            Noise::GetValues3D(noise3D, TEST_SEED, grid.x, grid.y, grid.z, sizeX, sizeY, sizeZ, values.data(), grid.step);
+            mismatches += CountMismatches(values, [&](std::size_t i) { return Noise::GetValue3D(noise3D, TEST_SEED, x(i, sizeY * sizeZ), y3D(i), z3D(i)); });
+            Noise::GetValues3D(cave, TEST_SEED, grid.x, grid.y, grid.z, sizeX, sizeY, sizeZ, values.data(), grid.step);
+            mismatches += CountMismatches(values, [&](std::size_t i) { return Noise::GetValue3D(cave, TEST_SEED, x(i, sizeY * sizeZ), y3D(i), z3D(i)); });
+            Noise::GetValues3D(ore, TEST_SEED, grid.x, grid.y, grid.z, sizeX, sizeY, sizeZ, values.data(), grid.step);
+            mismatches += CountMismatches(values, [&](std::size_t i) { return Noise::GetValue3D(ore, TEST_SEED, x(i, sizeY * sizeZ), y3D(i), z3D(i)); });
+        }
+
+        // Upsampled noise at its own lattice step and at full resolution
+        for (const glm::ivec3& origin : upsampledOrigins)
+        {
+            for (int sampleStep : { 1, 4 })
+            {
+                cave.m_sampleStep = sampleStep;
+                ore.m_sampleStep = sampleStep == 1 ? 1 : 3;
+                auto pos = [&](std::size_t i) { return origin + glm::ivec3((int)(i / (sizeY * sizeZ)), (int)(i / sizeZ % sizeY), (int)(i % sizeZ)); };
+                std::vector<float> values(sizeX * sizeY * sizeZ);
+                Noise::GetUpsampledValues3D(cave, TEST_SEED, origin.x, origin.y, origin.z, sizeX, sizeY, sizeZ, values.data());
+                mismatches += CountMismatches(values, [&](std::size_t i) { glm::ivec3 p = pos(i); return Noise::GetUpsampledValue3D(cave, TEST_SEED, p.x, p.y, p.z); });
+                Noise::GetUpsampledValues3D(ore, TEST_SEED, origin.x, origin.y, origin.z, sizeX, sizeY, sizeZ, values.data());
+                mismatches += CountMismatches(values, [&](std::size_t i) { glm::ivec3 p = pos(i); return Noise::GetUpsampledValue3D(ore, TEST_SEED, p.x, p.y, p.z); });
+            }
+        }
+
+        std::printf("    %s: %zu samples differ from the single sample path\n", Noise::GetSimdLevelName(level), mismatches);
+        Check(mismatches == 0, "batch noise matches single samples bit for bit");
+    }
+
+    Noise::SetSimdLevel(bestLevel);
+}
+
+// Generates the chunks at positions with a fresh generator on threadCount threads, taking
+// chunks in order from a shared counter like scuffed-pregen does
+static std::vector<std::vector<uint16_t>> GenerateRegion(const std::vector<glm::ivec3>& positions, int threadCount)
+{
+    StandardWorldGen standardWorldGen(TEST_SEED);
+    SMTerrainGen& gen = *standardWorldGen.m_worldGen;
+    std::vector<std::vector<uint16_t>> voxels(positions.size());
+    std::atomic<std::size_t> next = 0;
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < positions.size(); i = next++)
+        {
+            ChunkData data;
+            data.m_offset = positions[i] * CHUNK_SIZE;
+            gen.GenerateChunkData(data);
+            voxels[i].resize(CHUNK_VOLUME);
+            for (int index = 0; index < CHUNK_VOLUME; index++)
+                voxels[i][index] = data.GetBlockAtIndex(index);
+            gen.OnChunkDataUnloaded(data);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+    for (std::thread& thread : threads)
+        thread.join();
+    return voxels;
+}
+
+// Terrain doesn't depend on how many threads generate it or in which order chunks finish
+static void TestGenerationDeterminism()
+{
+    Noise::InitNoise();
+    RegisterStandardBlocks();
+
+    // Column by column like scuffed-pregen, so chunks sharing a heightmap are generated at the same time
+    std::vector<glm::ivec3> positions;
+    for (int x = -3; x <= 2; x++)
+        for (int z = -3; z <= 2; z++)
+            for (int y = -2; y <= 2; y++)
+                positions.push_back({ x, y, z });
+
+    const int threadCount = std::max((int)std::thread::hardware_concurrency(), 4);
+    std::vector<std::vector<uint16_t>> serial = GenerateRegion(positions, 1);
+    std::vector<std::vector<uint16_t>> parallel = GenerateRegion(positions, threadCount);
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        if (serial[i] == parallel[i])
+            continue;
+        if (mismatches++ == 0)
+            std::printf("    chunk %d %d %d differs on %d threads\n", positions[i].x, positions[i].y, positions[i].z, threadCount);
+    }
+    CheckEqual(mismatches, 0, "chunks that differ between 1 thread and many");
+}
+
+// Fraction of the cave voxels at full resolution that change when the standard world's cave noise
+// is sampled every step blocks, over a block of underground chunks
+static double MeasureCaveDrift(int step)
+{
+    StandardWorldGen standardWorldGen(TEST_SEED);
+    SMTerrainGen& gen = *standardWorldGen.m_worldGen;
+    std::vector<float> fullNoise(CHUNK_VOLUME), coarseNoise(CHUNK_VOLUME);
+    std::size_t caveVoxels = 0, changedVoxels = 0;
+    for (int x = -3; x <= 2; x++)
+        for (int y = -4; y <= -1; y++)
+            for (int z = -3; z <= 2; z++)
+            {
+                glm::ivec3 offset = glm::ivec3(x, y, z) * CHUNK_SIZE;
+                for (int l = 0; l < gen.m_caveNoiseLayers; l++)
+                {
+                    CaveNoiseSettings full = gen.m_caveNoiseSettings[l];
+                    full.m_sampleStep = 1;
+                    CaveNoiseSettings coarse = full;
+                    coarse.m_sampleStep = step;
+                    Noise::GetUpsampledValues3D(full, TEST_SEED, offset.x, offset.y, offset.z, CHUNK_SIZE, CHUNK_SIZE, CHUNK_SIZE, fullNoise.data());
+                    Noise::GetUpsampledValues3D(coarse, TEST_SEED, offset.x, offset.y, offset.z, CHUNK_SIZE, CHUNK_SIZE, CHUNK_SIZE, coarseNoise.data());
+                    for (int i = 0; i < CHUNK_VOLUME; i++)
+                    {
+                        bool fullCave = fullNoise[i] > full.m_noiseThreshold;
+                        caveVoxels += fullCave;
+                        changedVoxels += fullCave != (coarseNoise[i] > full.m_noiseThreshold);
+                    }
+                }
+            }
+    return caveVoxels == 0 ? 0.0 : (double)changedVoxels / caveVoxels;
+}
+
+// Coarse cave sampling keeps the shapes close to full resolution
+static void TestCaveSampleDrift()
+{
+    Noise::InitNoise();
+    RegisterStandardBlocks();
+
+    // Limits sit above the measured drift (about 1.9%, 9% and 33% of cave voxels at steps 2, 4 and 8)
+    // so only a real change to the sampling fails them
+    const struct { int step; double limit; } steps[] = { { 2, 0.03 }, { 4, 0.12 }, { 8, 0.40 } };
+    for (const auto& [step, limit] : steps)
+    {
+        double drift = MeasureCaveDrift(step);
+        std::printf("    step %d: %.1f%% of cave voxels differ, limit %.0f%%\n", step, drift * 100, limit * 100);
+        Check(drift <= limit, "cave drift within limit");
+    }
+}
+
+static std::vector<char> ReadBytes(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void WriteBytes(const std::filesystem::path& path, const std::vector<char>& bytes)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), (std::streamsize)bytes.size());
+}
+
+// Chunks come back from a save exactly as written, and damaged files are rejected without
+// touching the data they were loaded into
+static void TestWorldSaveRoundTrip()
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "willowvox_tests_world_save";
+    std::filesystem::remove_all(directory);
+    WorldSave save(directory);
+
+    int seed = 0;
+    Check(!save.LoadSeed(seed), "no seed before the save is created");
+    Check(save.Create(-12345), "save created");
+    Check(save.LoadSeed(seed) && seed == -12345, "seed loaded");
+
+    // Uniform chunks are one run of length 0: a 24 byte header and one 4 byte run
+    const glm::ivec3 uniformPos = { 2, -1, 3 };
+    ChunkData uniform;
+    uniform.m_offset = uniformPos * CHUNK_SIZE;
+    uniform.Fill(STONE);
+    Check(save.SaveChunkData(uniform), "uniform chunk saved");
+    Check(save.HasChunk(uniformPos), "uniform chunk found");
+    CheckEqual(ReadBytes(save.GetChunkPath(uniformPos)).size(), 28, "uniform chunk file size");
+
+    ChunkData uniformLoaded;
+    uniformLoaded.m_offset = uniform.m_offset;
+    uniformLoaded.SetBlock(1, 2, 3, GRASS_BLOCK);
+    Check(save.LoadChunkData(uniformLoaded), "uniform chunk loaded");
+    Check(uniformLoaded.IsUniform() && uniformLoaded.GetUniformBlock() == STONE, "uniform chunk loads uniform");
+
+    // Layers with scattered ids past the 8 bit palette, so runs of every length and 16 bit ids are written
+    const glm::ivec3 mixedPos = { -4, 0, 7 };
+    ChunkData mixed;
+    mixed.m_offset = mixedPos * CHUNK_SIZE;
+    for (int i = 0; i < CHUNK_VOLUME; i++)
+    {
+        int y = i / CHUNK_SIZE % CHUNK_SIZE;
+        uint16_t block = y < 10 ? STONE : y < 13 ? DIRT : y == 13 ? GRASS_BLOCK : AIR;
+        if (i % 97 == 0)
+            block = (uint16_t)(300 + i % 5);
+        mixed.SetBlockAtIndex(i, block);
+    }
+    Check(save.SaveChunkData(mixed), "mixed chunk saved");
+
+    ChunkData mixedLoaded;
+    mixedLoaded.m_offset = mixed.m_offset;
+    Check(save.LoadChunkData(mixedLoaded), "mixed chunk loaded");
+    std::size_t mismatches = 0;
+    for (int i = 0; i < CHUNK_VOLUME; i++)
+        mismatches += mixedLoaded.GetBlockAtIndex(i) != mixed.GetBlockAtIndex(i);
+    CheckEqual(mismatches, 0, "voxels that differ after loading the mixed chunk");
+
+    const glm::ivec3 missingPos = { 0, 5, 0 };
+    ChunkData missing;
+    missing.m_offset = missingPos * CHUNK_SIZE;
+    Check(!save.HasChunk(missingPos) && !save.LoadChunkData(missing), "unsaved chunk not loaded");
+
+    // Each damaged copy of the mixed chunk's file must fail to load and leave the data as it was
+    const std::vector<char> mixedBytes = ReadBytes(save.GetChunkPath(mixedPos));
+    std::vector<std::pair<const char*, std::vector<char>>> damaged;
+    damaged.push_back({ "empty file", {} });
+    damaged.push_back({ "truncated header", std::vector<char>(mixedBytes.begin(), mixedBytes.begin() + 10) });
+    damaged.push_back({ "truncated runs", std::vector<char>(mixedBytes.begin(), mixedBytes.end() - 3) });
+    std::vector<char> badMagic = mixedBytes;
+    badMagic[0] ^= 0x55;
+    damaged.push_back({ "bad magic", badMagic });
+    std::vector<char> badVersion = mixedBytes;
+    badVersion[4] = 99;
+    damaged.push_back({ "unknown version", badVersion });
+    std::vector<char> badLength = mixedBytes;
+    badLength[badLength.size() - 2]++;  // The last run's length, which now overruns the chunk
+    damaged.push_back({ "runs not covering the chunk", badLength });
+    std::vector<char> extraRun = mixedBytes;
+    extraRun[20]++;  // The run count, now one more than the file holds
+    damaged.push_back({ "run count past the end", extraRun });
+
+    for (const auto& [what, bytes] : damaged)
+    {
+        WriteBytes(save.GetChunkPath(mixedPos), bytes);
+        ChunkData data;
+        data.m_offset = mixed.m_offset;
+        data.Fill(DIRT);
+        bool loaded = save.LoadChunkData(data);
+        std::printf("    %s: %s\n", what, loaded ? "loaded" : "rejected");
+        Check(!loaded && data.IsUniform() && data.GetUniformBlock() == DIRT, "damaged chunk file rejected");
+    }
+
+    // A file saved for another position is rejected too
+    std::filesystem::copy_file(save.GetChunkPath(uniformPos), save.GetChunkPath(missingPos));
+    Check(!save.LoadChunkData(missing), "chunk file of another position rejected");
+
+    std::filesystem::remove_all(directory);
+}
+
+struct Test
+{
+    const char* name;
+    std::function<void()> run;
+};
+
+static const std::vector<Test> tests = {
+    { "section_remesh", TestSectionRemesh },
+    { "chunk_vertex_packing", TestChunkVertexPacking },
+    { "chunk_grid_resize", TestChunkGridResize },
+    { "noise_simd_matches_scalar", TestNoiseSimdMatchesScalar },
+    { "generation_determinism", TestGenerationDeterminism },
+    { "cave_sample_drift", TestCaveSampleDrift },
+    { "world_save_round_trip", TestWorldSaveRoundTrip },
+};
+
+// Runs the test named on the command line, or all of them. Exits with 1 if any fail.
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int ran = 0, failures = 0;
+    for (const Test& test : tests)
+    {
+        if (filter != nullptr && std::strcmp(filter, test.name) != 0)
+            continue;
+
+        std::printf("%s\n", test.name);
+        failed = false;
+        test.run();
+        std::printf("    %s\n", failed ? "FAIL" : "PASS");
+        ran++;
+        failures += failed;
+    }
+
+    if (ran == 0)
+    {
+        std::printf("No test named %s\n", filter);
+        return 1;
+    }
+    std::printf("%d of %d tests passed\n", ran - failures, ran);
+    return failures == 0 ? 0 : 1;
+}
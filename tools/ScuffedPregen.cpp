@@ -0,0 +1,264 @@
+#include <StandardWorldGen.h>
+#include <StandardBlocks.h>
+#include <WillowVox/math/Noise.h>
+#include <WillowVox/world/Chunk.h>
+#include <WillowVox/world/ChunkManager.h>
+#include <WillowVox/world/WorldSave.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef PLATFORM_WINDOWS
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace WillowVox;
+using namespace ScuffedMinecraft;
+
+// Pregenerates a region of the standard world into a world save without a window or GL context:
+// scuffed-pregen --seed 0 --region -16 -16 15 15 --height -2 2 --threads 8 --out world
+static void PrintUsage()
+{
+    printf("Usage: scuffed-pregen [options]\n"
+           "  --seed N                        world seed (default 0)\n"
+           "  --region MINX MINZ MAXX MAXZ    chunk columns to generate, inclusive (default -8 -8 7 7)\n"
+           "  --height MINY MAXY              chunk layers to generate, inclusive (default -2 2)\n"
+           "  --threads N                     worker threads (default: all cores)\n"
+           "  --out DIR                       world save directory (default world)\n"
+           "  --no-save                       generate and mesh without writing the save\n");
+}
+
+static size_t GetPeakRSS()
+{
+#ifdef PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize;
+    return 0;
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef PLATFORM_MACOS
+    return (size_t)usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+// Runs work(i) for every i below count on threadCount threads. Fills latencies (seconds per item)
+// and returns the wall time in seconds.
+template <typename Work>
+static double RunStage(size_t count, int threadCount, std::vector<double>& latencies, Work work)
+{
+    latencies.assign(count, 0.0);
+    std::atomic<size_t> next = 0;
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            work(i);
+            latencies[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+    for (std::thread& thread : threads)
+        thread.join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Percentiles and a power of two histogram of the latencies in microseconds
+static void PrintStage(const char* name, std::vector<double> latencies, double wallTime)
+{
+    if (latencies.empty())
+        return;
+
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (double latency : latencies)
+        total += latency;
+    auto percentile = [&](double p) { return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))] * 1e6; };
+
+    printf("\n%s: %zu chunks in %.3f s, %.1f chunks/s\n", name, latencies.size(), wallTime, latencies.size() / wallTime);
+    printf("  mean %.1f us  p50 %.1f us  p90 %.1f us  p99 %.1f us  max %.1f us\n",
+        total / latencies.size() * 1e6, percentile(0.5), percentile(0.9), percentile(0.99), latencies.back() * 1e6);
+
+    const int bucketCount = 32;
+    size_t buckets[bucketCount] = {};
+    for (double latency : latencies)
+    {
+        int bucket = 0;
+        for (double us = latency * 1e6; us >= 2 && bucket < bucketCount - 1; us /= 2)
+            bucket++;
+        buckets[bucket]++;
+    }
+
+    size_t largest = *std::max_element(buckets, buckets + bucketCount);
+    for (int i = 0; i < bucketCount; i++)
+    {
+        if (buckets[i] == 0)
+            continue;
+        int bar = (int)((buckets[i] * 40 + largest - 1) / largest);
+        unsigned long long low = i == 0 ? 0 : 1ull << i;
+        printf("  %8llu - %-8llu us %8zu  %s\n", low, 1ull << (i + 1), buckets[i], std::string(bar, '#').c_str());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int seed = 0;
+    int minX = -8, minZ = -8, maxX = 7, maxZ = 7;
+    int minY = -2, maxY = 2;
+    int threadCount = std::max((int)std::thread::hardware_concurrency(), 1);
+    const char* outDir = "world";
+    bool save = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        auto hasArgs = [&](int count) { return i + count < argc; };
+        if (strcmp(argv[i], "--seed") == 0 && hasArgs(1))
+            seed = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--region") == 0 && hasArgs(4))
+        {
+            minX = atoi(argv[++i]);
+            minZ = atoi(argv[++i]);
+            maxX = atoi(argv[++i]);
+            maxZ = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--height") == 0 && hasArgs(2))
+        {
+            minY = atoi(argv[++i]);
+            maxY = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && hasArgs(1))
+            threadCount = std::max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--out") == 0 && hasArgs(1))
+            outDir = argv[++i];
+        else if (strcmp(argv[i], "--no-save") == 0)
+            save = false;
+        else
+        {
+            PrintUsage();
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (minX > maxX || minZ > maxZ || minY > maxY)
+    {
+        fprintf(stderr, "Empty region\n");
+        return 1;
+    }
+
+    Noise::InitNoise();
+    RegisterStandardBlocks();
+    StandardWorldGen standardWorldGen(seed);
+    SMTerrainGen& gen = *standardWorldGen.m_worldGen;
+
+    WorldSave worldSave(outDir);
+    if (save && !worldSave.Create(seed))
+    {
+        fprintf(stderr, "Couldn't create world save in %s\n", outDir);
+        return 1;
+    }
+
+    // Column by column so chunks sharing a heightmap are generated close together
+    int sizeX = maxX - minX + 1, sizeY = maxY - minY + 1, sizeZ = maxZ - minZ + 1;
+    size_t chunkCount = (size_t)sizeX * sizeY * sizeZ;
+    auto getIndex = [&](int x, int y, int z) { return ((size_t)(x - minX) * sizeZ + (z - minZ)) * sizeY + (y - minY); };
+    std::vector<glm::ivec3> positions(chunkCount);
+    for (int x = minX; x <= maxX; x++)
+        for (int z = minZ; z <= maxZ; z++)
+            for (int y = minY; y <= maxY; y++)
+                positions[getIndex(x, y, z)] = { x, y, z };
+
+    printf("Pregenerating seed %d, chunks x %d..%d, y %d..%d, z %d..%d (%zu chunks) on %d threads, noise SIMD %s\n",
+        seed, minX, maxX, minY, maxY, minZ, maxZ, chunkCount, threadCount, Noise::GetSimdLevelName(Noise::GetSimdLevel()));
+
+    std::vector<ChunkData*> chunkData(chunkCount);
+    std::vector<double> generateLatencies, meshLatencies, saveLatencies;
+    double generateTime = RunStage(chunkCount, threadCount, generateLatencies, [&](size_t i) {
+        ChunkData* data = new ChunkData();
+        data->m_offset = positions[i] * CHUNK_SIZE;
+        gen.GenerateChunkData(*data);
+        chunkData[i] = data;
+    });
+
+    // Chunks on the region's edge mesh against air where their neighbors weren't generated
+    auto getChunkData = [&](const glm::ivec3& pos) -> ChunkData* {
+        if (pos.x < minX || pos.x > maxX || pos.y < minY || pos.y > maxY || pos.z < minZ || pos.z > maxZ)
+            return nullptr;
+        return chunkData[getIndex(pos.x, pos.y, pos.z)];
+    };
+
+    // The manager is never started, chunks only need it for edits
+    ChunkManager chunkManager(gen);
+    std::atomic<size_t> vertexCount = 0, meshBytes = 0;
+    double meshTime = RunStage(chunkCount, threadCount, meshLatencies, [&](size_t i) {
+        glm::ivec3 pos = positions[i];
+        Chunk chunk(chunkManager, nullptr, nullptr, nullptr, pos, glm::vec3(pos * CHUNK_SIZE));
+        chunk.m_chunkData = chunkData[i];
+        for (int d = 0; d < 6; d++)
+            chunk.m_neighborData[d] = getChunkData(pos + Chunk::FACE_NORMALS[d]);
+        chunk.GenerateChunkMeshData();
+        vertexCount += chunk.GetMeshVertexCount();
+        meshBytes += chunk.GetMeshDataSize();
+    });
+
+    std::atomic<size_t> failedSaves = 0;
+    double saveTime = 0;
+    if (save)
+    {
+        saveTime = RunStage(chunkCount, threadCount, saveLatencies, [&](size_t i) {
+            if (!worldSave.SaveChunkData(*chunkData[i]))
+                failedSaves++;
+        });
+    }
+
+    // FNV-1a over every voxel in region order, the same for any thread count
+    uint64_t hash = 14695981039346656037ull;
+    size_t dataBytes = 0;
+    for (ChunkData* data : chunkData)
+    {
+        for (int i = 0; i < CHUNK_VOLUME; i++)
+            hash = (hash ^ data->GetBlockAtIndex(i)) * 1099511628211ull;
+        dataBytes += data->GetMemoryUsage();
+    }
+
+    PrintStage("Generate", generateLatencies, generateTime);
+    PrintStage("Mesh", meshLatencies, meshTime);
+    PrintStage("Save", saveLatencies, saveTime);
+
+    double totalTime = generateTime + meshTime + saveTime;
+    printf("\nTotal: %zu chunks in %.3f s, %.1f chunks/s\n", chunkCount, totalTime, chunkCount / totalTime);
+    printf("Voxel data %.1f MB, mesh data %.1f MB (%zu vertices)\n", dataBytes / 1048576.0, meshBytes / 1048576.0, (size_t)vertexCount);
+    printf("Peak RSS %.1f MB\n", GetPeakRSS() / 1048576.0);
+    printf("World hash %016llx\n", (unsigned long long)hash);
+    if (save)
+        printf("Saved to %s\n", outDir);
+
+    for (ChunkData* data : chunkData)
+    {
+        gen.OnChunkDataUnloaded(*data);
+        delete data;
+    }
+
+    if (failedSaves > 0)
+    {
+        fprintf(stderr, "%zu chunks failed to save\n", (size_t)failedSaves);
+        return 1;
+    }
+    return 0;
+}